@@ -0,0 +1,120 @@
+/*
+ * Construction of a LinkedList from an array of pointers, and copy of a LinkedList to an array.
+ * Build from the root of the repository :
+ * 		gcc -O2 -pthread -o bench_array benchmarks/bench_array.c linked_list.c linked_list_stats.c -I.
+ * Usage : ./bench_array [maximum number of elements]
+ * The list is built with add_at_the_end (only up to 10^4 elements, it is in O(n^2)),
+ * with add_to_top on a tail pointer (one malloc(3) per cell), and with linked_list_from_array.
+ * Each list is then traversed and freed. The copy to an array compares a loop on 'next' with linked_list_to_array.
+ * The output is CSV, in ns per element.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "bench_common.h"
+
+#define AT_THE_END_MAX 10000
+
+/*
+ * This function sums the data of list, to measure its traversal.
+ */
+long traverse(LinkedList *list) {
+
+	long sum = 0;
+
+	for (; list != NULL; list = list->next)
+		sum += (long)list->data;
+
+	return sum;
+
+}
+
+/*
+ * This function measures the traversal and the release of list, and checks its sum.
+ */
+void measure_list(LinkedList *list, long expected, double *traversal, double *release) {
+
+	struct timespec start;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	if (traverse(list) != expected)
+		fprintf(stderr, "error: wrong sum.\n");
+	*traversal = elapsed(&start);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	free_linked_list(&list);
+	*release = elapsed(&start);
+
+}
+
+int main(int argc, char *argv[]) {
+
+	long max = (argc > 1) ? atol(argv[1]) : 10000000, size, i, expected;
+	void **array, **copy;
+	LinkedList *list, **tail, *cell;
+	struct timespec start;
+	double end_build = 0, end_traversal = 0, end_release = 0, tail_build, tail_traversal, tail_release;
+	double array_build, array_traversal, array_release, loop_copy, to_array;
+
+	printf("elements,add_at_the_end,add_at_the_end_traversal,add_at_the_end_free,add_to_top_tail,add_to_top_tail_traversal,add_to_top_tail_free,"
+		"from_array,from_array_traversal,from_array_free,loop_to_array,linked_list_to_array\n");
+	for (size = 1000; size <= max; size *= 10) {
+		array = malloc(size * sizeof(void *));
+		copy = malloc(size * sizeof(void *));
+		for (i = 0; i < size; i++)
+			array[i] = (void *)i;
+		expected = size * (size - 1) / 2;
+
+		if (size <= AT_THE_END_MAX) {
+			list = NULL;
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			for (i = 0; i < size; i++)
+				add_at_the_end(&list, array[i], print_int, free_nothing);
+			end_build = elapsed(&start);
+			measure_list(list, expected, &end_traversal, &end_release);
+		}
+
+		list = NULL;
+		tail = &list;
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (i = 0; i < size; i++) {
+			add_to_top(tail, array[i], print_int, free_nothing);
+			tail = &((*tail)->next);
+		}
+		tail_build = elapsed(&start);
+		measure_list(list, expected, &tail_traversal, &tail_release);
+
+		list = NULL;
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		if (!linked_list_from_array(&list, array, size, print_int, free_nothing))
+			return EXIT_FAILURE;
+		array_build = elapsed(&start);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (i = 0, cell = list; cell != NULL && i < size; cell = cell->next, i++)
+			copy[i] = cell->data;
+		loop_copy = elapsed(&start);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		if (linked_list_to_array(list, copy, size) != (size_t)size || copy[size - 1] != array[size - 1])
+			fprintf(stderr, "error: wrong copy.\n");
+		to_array = elapsed(&start);
+
+		measure_list(list, expected, &array_traversal, &array_release);
+
+		if (size <= AT_THE_END_MAX)
+			printf("%ld,%.2f,%.2f,%.2f,", size, end_build / size * 1e9, end_traversal / size * 1e9, end_release / size * 1e9);
+		else
+			printf("%ld,,,,", size);
+		printf("%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f\n", tail_build / size * 1e9, tail_traversal / size * 1e9, tail_release / size * 1e9,
+			array_build / size * 1e9, array_traversal / size * 1e9, array_release / size * 1e9, loop_copy / size * 1e9, to_array / size * 1e9);
+
+		free(array);
+		free(copy);
+	}
+
+	return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,83 @@
+#ifndef HEADER_BENCH_COMMON_H_
+#define HEADER_BENCH_COMMON_H_
+
+/*
+ * Timing and data functions shared by the benchmarks.
+ * A benchmark defines _POSIX_C_SOURCE before its first include, for clock_gettime(2).
+ * The functions are static inline, so each benchmark stays one file and the unused ones cost nothing.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/*
+ * This function returns the number of seconds since start, measured with CLOCK_MONOTONIC.
+ */
+static inline double elapsed(struct timespec *start) {
+
+	struct timespec end;
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) * 1e-9;
+
+}
+
+/*
+ * Integers stored in the data pointer itself, as (void *)value : nothing is allocated nor freed.
+ */
+
+static inline void print_int(void *data) {
+	printf("%ld ", (long)data);
+}
+
+static inline int format_int(void *data, char *buffer, size_t size) {
+	return snprintf(buffer, size, "%ld", (long)data);
+}
+
+static inline void free_nothing(void **data) {
+	*data = NULL;
+}
+
+static inline int cmp_int(void *data1, void *data2) {
+	return ((long)data1 > (long)data2) - ((long)data1 < (long)data2);
+}
+
+/*
+ * Integers allocated with malloc(3), one per data, as the components which own their data do.
+ */
+
+/*
+ * This function returns a new int allocated with malloc(3), or exits if there were an allocation problem.
+ */
+static inline int * new_boxed_int(int value) {
+
+	int *data = malloc(sizeof(int));
+
+	if (NULL == data) {
+		fprintf(stderr, "error: allocation fail.\n");
+		exit(EXIT_FAILURE);
+	}
+	*data = value;
+
+	return data;
+
+}
+
+static inline void print_boxed_int(void *data) {
+	printf("%d ", *(int *)data);
+}
+
+static inline void free_boxed_int(void **data) {
+	free(*data);
+	*data = NULL;
+}
+
+static inline int cmp_boxed_int(void *data1, void *data2) {
+	return (*(int *)data1 > *(int *)data2) - (*(int *)data1 < *(int *)data2);
+}
+
+
+#endif /* HEADER_BENCH_COMMON_H_ */
@@ -0,0 +1,127 @@
+/*
+ * Traversal of a scattered LinkedList before and after linked_list_compact.
+ * Build from the root of the repository :
+ * 		gcc -O2 -pthread -o bench_compact benchmarks/bench_compact.c linked_list.c linked_list_stats.c -I.
+ * Usage : ./bench_compact [maximum number of elements] [cells per incremental step]
+ * The cells are linked in a random order of their addresses, as after a long churn of insertions and removals.
+ * The caches are flushed before each traversal.
+ * The compaction is measured at once, and in incremental steps on another copy of the scattered list.
+ * The output is CSV, in ns per element.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "bench_common.h"
+
+#define FLUSH_SIZE (64 * 1024 * 1024)
+
+/*
+ * This function builds a list of the values 0 to size - 1, whose cells are linked in a random order of their addresses.
+ */
+LinkedList * scattered_list(long size) {
+
+	LinkedList *list = NULL, *cell, **cells, *tmp;
+	long i, j;
+
+	cells = malloc(size * sizeof(LinkedList *));
+	for (i = 0; i < size; i++)
+		add_to_top(&list, NULL, print_int, free_nothing);
+	for (cell = list, i = 0; cell != NULL; cell = cell->next, i++)
+		cells[i] = cell;
+	for (i = size - 1; i > 0; i--) {
+		j = rand() % (i + 1);
+		tmp = cells[i];
+		cells[i] = cells[j];
+		cells[j] = tmp;
+	}
+	for (i = 0; i < size; i++) {
+		cells[i]->data = (void *)i;
+		cells[i]->next = (i + 1 < size) ? cells[i + 1] : NULL;
+	}
+	list = cells[0];
+
+	free(cells);
+
+	return list;
+
+}
+
+/*
+ * This function evicts the list from the caches by touching every line of a large buffer.
+ */
+void flush(volatile char *buffer) {
+
+	long i;
+
+	for (i = 0; i < FLUSH_SIZE; i += 64)
+		buffer[i] += 1;
+
+}
+
+/*
+ * This function measures a cold traversal of list, and checks its sum.
+ */
+double cold_traversal(LinkedList *list, long size, char *buffer) {
+
+	struct timespec start;
+	double time;
+	long sum = 0;
+
+	flush(buffer);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (; list != NULL; list = list->next)
+		sum += (long)list->data;
+	time = elapsed(&start);
+	if (sum != size * (size - 1) / 2)
+		fprintf(stderr, "error: wrong sum.\n");
+
+	return time;
+
+}
+
+int main(int argc, char *argv[]) {
+
+	long max = (argc > 1) ? atol(argv[1]) : 10000000, size, steps;
+	size_t step = (argc > 2) ? (size_t)atol(argv[2]) : 4096;
+	char *buffer = calloc(FLUSH_SIZE, 1);
+	LinkedList *list;
+	LinkedListCompaction compaction;
+	struct timespec start;
+	double before, compact, after, incremental, incremental_after;
+
+	srand(1);
+	printf("elements,scattered_traversal,compact,compact_traversal,incremental_compact,steps,incremental_compact_traversal\n");
+	for (size = 1000; size <= max; size *= 10) {
+		list = scattered_list(size);
+		before = cold_traversal(list, size, buffer);
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		if (!linked_list_compact(&list))
+			return EXIT_FAILURE;
+		compact = elapsed(&start);
+		after = cold_traversal(list, size, buffer);
+		free_linked_list(&list);
+
+		list = scattered_list(size);
+		steps = 0;
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		begin_linked_list_compaction(&compaction, &list);
+		while (!linked_list_compaction_done(&compaction)) {
+			if (!linked_list_compact_step(&compaction, step))
+				return EXIT_FAILURE;
+			steps += 1;
+		}
+		incremental = elapsed(&start);
+		incremental_after = cold_traversal(list, size, buffer);
+		free_linked_list(&list);
+
+		printf("%ld,%.2f,%.2f,%.2f,%.2f,%ld,%.2f\n", size, before / size * 1e9, compact / size * 1e9, after / size * 1e9,
+			incremental / size * 1e9, steps, incremental_after / size * 1e9);
+	}
+
+	free(buffer);
+
+	return EXIT_SUCCESS;
+
+}
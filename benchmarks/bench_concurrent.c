@@ -0,0 +1,113 @@
+/*
+ * Multi-producer add on the top : concurrent_add_to_top against add_to_top under a global mutex.
+ * Build from the root of the repository :
+ * 		gcc -O2 -pthread -o bench_concurrent benchmarks/bench_concurrent.c concurrent_linked_list.c linked_list.c -I.
+ * Usage : ./bench_concurrent [number of additions] [maximum number of threads]
+ * The output is CSV, in millions of additions per second for all the threads.
+ * The cells of the concurrent list are released after each run, so the measured runs reuse them.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include "linked_list.h"
+#include "concurrent_linked_list.h"
+#include "bench_common.h"
+
+struct producer {
+	long count;
+	LinkedList **list;
+	pthread_mutex_t *mutex;
+	ConcurrentLinkedList *concurrent;
+};
+
+void * produce_locked(void *argument) {
+
+	struct producer *producer = (struct producer *)argument;
+	long i;
+
+	for (i = 0; i < producer->count; i++) {
+		pthread_mutex_lock(producer->mutex);
+		add_to_top(producer->list, (void *)i, print_int, free_nothing);
+		pthread_mutex_unlock(producer->mutex);
+	}
+
+	return NULL;
+
+}
+
+void * produce_concurrent(void *argument) {
+
+	struct producer *producer = (struct producer *)argument;
+	long i;
+
+	for (i = 0; i < producer->count; i++)
+		concurrent_add_to_top(producer->concurrent, (void *)i, print_int, free_nothing);
+
+	return NULL;
+
+}
+
+double run(void *(*produce)(void *), struct producer *producer, int threads) {
+
+	pthread_t id[64];
+	struct timespec start;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < threads; i++)
+		pthread_create(&id[i], NULL, produce, producer);
+	for (i = 0; i < threads; i++)
+		pthread_join(id[i], NULL);
+
+	return elapsed(&start);
+
+}
+
+int main(int argc, char *argv[]) {
+
+	long additions = (argc > 1) ? atol(argv[1]) : 4000000;
+	int max_threads = (argc > 2) ? atoi(argv[2]) : 8;
+	LinkedList *list = NULL, *cells;
+	ConcurrentLinkedList concurrent;
+	pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+	struct producer producer;
+	double locked, lock_free;
+	int threads;
+
+	if (max_threads > 64)
+		max_threads = 64;
+
+	init_concurrent_linked_list(&concurrent);
+	producer.list = &list;
+	producer.mutex = &mutex;
+	producer.concurrent = &concurrent;
+
+	/* first run to fill the released cells */
+	producer.count = additions;
+	run(produce_concurrent, &producer, 1);
+	cells = concurrent_take_all(&concurrent);
+	concurrent_release_cells(&cells);
+
+	printf("threads,mutex_add_to_top,concurrent_add_to_top\n");
+	for (threads = 1; threads <= max_threads; threads *= 2) {
+		producer.count = additions / threads;
+
+		locked = run(produce_locked, &producer, threads);
+		if (linked_list_size(list) != producer.count * threads)
+			fprintf(stderr, "error: %d cells in the locked list.\n", linked_list_size(list));
+		free_linked_list(&list);
+
+		lock_free = run(produce_concurrent, &producer, threads);
+		cells = concurrent_take_all(&concurrent);
+		if (linked_list_size(cells) != producer.count * threads)
+			fprintf(stderr, "error: %d cells in the concurrent list.\n", linked_list_size(cells));
+		concurrent_release_cells(&cells);
+
+		printf("%d,%.2f,%.2f\n", threads, producer.count * threads / locked * 1e-6, producer.count * threads / lock_free * 1e-6);
+	}
+
+	return EXIT_SUCCESS;
+
+}
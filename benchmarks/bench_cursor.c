@@ -0,0 +1,163 @@
+/*
+ * Traversal of a cold, scattered LinkedList : hand-written loop on 'next' against LinkedListCursor.
+ * Build from the root of the repository :
+ * 		gcc -O2 -o bench_cursor benchmarks/bench_cursor.c linked_list_cursor.c linked_list.c -I.
+ * 		(add -DLINKED_LIST_PREFETCH_DISTANCE=n to try another distance)
+ * Usage : ./bench_cursor [maximum number of elements]
+ * The cells are linked in a random order of their addresses, and each data points to a record
+ * allocated apart, also in a random order. The caches are flushed before each measure.
+ * Each traversal is done twice : summing the records, and with some computation on each record,
+ * which is when the prefetch can load the next cells during the computation.
+ * The output is CSV, in ns per element.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "linked_list_cursor.h"
+#include "bench_common.h"
+
+#define BATCH 16
+#define FLUSH_SIZE (64 * 1024 * 1024)
+#define WORK_ROUNDS 40
+
+struct record {
+	long value;
+	char padding[56];
+};
+
+void print_record(void *data) {
+	printf("%ld ", ((struct record *)data)->value);
+}
+
+void shuffle(void **array, long size) {
+
+	long i, j;
+	void *tmp;
+
+	for (i = size - 1; i > 0; i--) {
+		j = rand() % (i + 1);
+		tmp = array[i];
+		array[i] = array[j];
+		array[j] = tmp;
+	}
+
+}
+
+/*
+ * This function builds a list of 'size' records, whose cells and records are linked in random orders.
+ */
+LinkedList * scattered_list(long size, struct record *records) {
+
+	LinkedList *list = NULL, *cell;
+	void **cells, **data;
+	long i;
+
+	cells = malloc(size * sizeof(void *));
+	data = malloc(size * sizeof(void *));
+	for (i = 0; i < size; i++) {
+		records[i].value = i;
+		data[i] = &records[i];
+		add_to_top(&list, NULL, print_record, free_nothing);
+	}
+	for (cell = list, i = 0; cell != NULL; cell = cell->next, i++)
+		cells[i] = cell;
+
+	shuffle(cells, size);
+	shuffle(data, size);
+	for (i = 0; i < size; i++) {
+		((LinkedList *)cells[i])->data = data[i];
+		((LinkedList *)cells[i])->next = (i + 1 < size) ? cells[i + 1] : NULL;
+	}
+	list = cells[0];
+
+	free(cells);
+	free(data);
+
+	return list;
+
+}
+
+long work(struct record *record, int rounds) {
+
+	unsigned long x = (unsigned long)record->value;
+	int i;
+
+	for (i = 0; i < rounds; i++)
+		x = x * 6364136223846793005UL + 1442695040888963407UL;
+
+	return (long)(x >> 40);
+
+}
+
+/*
+ * This function evicts the list from the caches by touching every line of a large buffer.
+ * memset(3) is not used : for large sizes, it may write around the caches.
+ */
+void flush(volatile char *buffer) {
+
+	long i;
+
+	for (i = 0; i < FLUSH_SIZE; i += 64)
+		buffer[i] += 1;
+
+}
+
+int main(int argc, char *argv[]) {
+
+	long max = (argc > 1) ? atol(argv[1]) : 10000000, size, sum, check, i;
+	struct record *records;
+	LinkedList *list, *cell;
+	LinkedListCursor cursor;
+	struct timespec start;
+	double loop, cursor_next, cursor_batch;
+	int rounds;
+	char *buffer = calloc(FLUSH_SIZE, 1);
+	void *batch[BATCH];
+	size_t count;
+
+	srand(1);
+	printf("elements,work_rounds,next_loop,cursor_next,cursor_next_n\n");
+	for (size = 1000; size <= max; size *= 10) {
+		records = malloc(size * sizeof(struct record));
+		list = scattered_list(size, records);
+
+		for (rounds = 0; rounds <= WORK_ROUNDS; rounds += WORK_ROUNDS) {
+			flush(buffer);
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			for (check = 0, cell = list; cell != NULL; cell = cell->next)
+				check += work((struct record *)cell->data, rounds);
+			loop = elapsed(&start);
+
+			flush(buffer);
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			for (sum = 0, cell = linked_list_cursor_begin(&cursor, &list); cell != NULL; cell = linked_list_cursor_next(&cursor))
+				sum += work((struct record *)cell->data, rounds);
+			cursor_next = elapsed(&start);
+			if (sum != check)
+				fprintf(stderr, "error: wrong sum.\n");
+
+			flush(buffer);
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			sum = 0;
+			linked_list_cursor_begin(&cursor, &list);
+			while ((count = linked_list_cursor_next_n(&cursor, batch, BATCH)) > 0)
+				for (i = 0; i < (long)count; i++)
+					sum += work((struct record *)batch[i], rounds);
+			cursor_batch = elapsed(&start);
+			if (sum != check)
+				fprintf(stderr, "error: wrong sum.\n");
+
+			printf("%ld,%d,%.2f,%.2f,%.2f\n", size, rounds, loop / size * 1e9, cursor_next / size * 1e9, cursor_batch / size * 1e9);
+		}
+
+		free_linked_list(&list);
+		free(records);
+	}
+
+	free(buffer);
+
+	return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,89 @@
+/*
+ * Search of k keys in a LinkedList : find_first_occurrence and find_last_occurrence for each key,
+ * against one call to find_occurrences, without and with a hash function.
+ * Build from the root of the repository :
+ * 		gcc -O2 -pthread -o bench_find_batch benchmarks/bench_find_batch.c linked_list.c linked_list_stats.c -I.
+ * Usage : ./bench_find_batch [maximum number of elements]
+ * Half of the keys are in the list. The measures in O(n * k) are skipped when n * k is over 10^9.
+ * The output is CSV, in microseconds per batch of keys.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "bench_common.h"
+
+#define QUADRATIC_MAX 1000000000L
+
+unsigned long hash_long(void *data) {
+	return (unsigned long)(long)data * 11400714819323198485UL;
+}
+
+int main(int argc, char *argv[]) {
+
+	long max = (argc > 1) ? atol(argv[1]) : 1000000, size, keys, i;
+	LinkedList *list, **first, **last;
+	void **targets;
+	struct timespec start;
+	double loop, batch, hashed;
+	size_t found, expected;
+
+	srand(1);
+	printf("elements,keys,find_first_and_last_loop,find_occurrences,find_occurrences_hash\n");
+	for (size = 1000; size <= max; size *= 10) {
+		list = NULL;
+		for (i = size - 1; i >= 0; i--)
+			add_to_top(&list, (void *)(2 * i), print_int, free_nothing);
+
+		for (keys = 4; keys <= 4096; keys *= 8) {
+			targets = malloc(keys * sizeof(void *));
+			first = malloc(keys * sizeof(LinkedList *));
+			last = malloc(keys * sizeof(LinkedList *));
+			for (i = 0; i < keys; i++)
+				targets[i] = (void *)(rand() % (2 * size));
+			for (expected = 0, i = 0; i < keys; i++)
+				expected += ((long)targets[i] % 2 == 0);
+
+			loop = -1;
+			batch = -1;
+			if (size * keys <= QUADRATIC_MAX) {
+				clock_gettime(CLOCK_MONOTONIC, &start);
+				for (found = 0, i = 0; i < keys; i++) {
+					first[i] = find_first_occurrence(list, targets[i], cmp_int);
+					last[i] = find_last_occurrence(list, targets[i], cmp_int);
+					found += (first[i] != NULL);
+				}
+				loop = elapsed(&start);
+				if (found != expected)
+					fprintf(stderr, "error: wrong search.\n");
+
+				clock_gettime(CLOCK_MONOTONIC, &start);
+				if (find_occurrences(list, targets, keys, cmp_int, NULL, first, last) != expected)
+					fprintf(stderr, "error: wrong search.\n");
+				batch = elapsed(&start);
+			}
+
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			if (find_occurrences(list, targets, keys, cmp_int, hash_long, first, last) != expected)
+				fprintf(stderr, "error: wrong search.\n");
+			hashed = elapsed(&start);
+
+			printf("%ld,%ld,", size, keys);
+			if (loop >= 0)
+				printf("%.1f,%.1f,", loop * 1e6, batch * 1e6);
+			else
+				printf(",,");
+			printf("%.1f\n", hashed * 1e6);
+
+			free(targets);
+			free(first);
+			free(last);
+		}
+
+		free_linked_list(&list);
+	}
+
+	return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,72 @@
+/*
+ * List of integers : a LinkedList of allocated ints against an InlineLinkedList of inline ints.
+ * Build from the root of the repository :
+ * 		gcc -O2 -pthread -o bench_inline benchmarks/bench_inline.c inline_linked_list.c linked_list.c linked_list_stats.c -I.
+ * Usage : ./bench_inline [maximum number of elements]
+ * The LinkedList is built as in main.c : each int is allocated with malloc(3) and compared with cmp_boxed_int.
+ * Both lists are built before the measures of the searches and of the releases,
+ * so neither is built in the memory freed by the other.
+ * Each search is a search of a missing int, so the whole list is traversed.
+ * The output is CSV, in ns per element.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "inline_linked_list.h"
+#include "bench_common.h"
+
+int main(int argc, char *argv[]) {
+
+	long max = (argc > 1) ? atol(argv[1]) : 10000000, size;
+	LinkedList *list, **tail;
+	InlineLinkedList inline_list;
+	struct timespec start;
+	double build, search, release, inline_build, inline_search, inline_release;
+	int i, *value, missing = -1;
+
+	printf("elements,linked_list_build,linked_list_search,linked_list_free,inline_build,inline_search,inline_free\n");
+	for (size = 1000; size <= max; size *= 10) {
+		list = NULL;
+		tail = &list;
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (i = 0; i < size; i++) {
+			value = malloc(sizeof(int));
+			*value = i;
+			add_to_top(tail, value, print_boxed_int, free_boxed_int);
+			tail = &((*tail)->next);
+		}
+		build = elapsed(&start);
+
+		init_inline_linked_list(&inline_list, &inline_int_type);
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (i = 0; i < size; i++)
+			inline_add_at_the_end(&inline_list, &i);
+		inline_build = elapsed(&start);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		if (find_first_occurrence(list, &missing, cmp_boxed_int) != NULL)
+			fprintf(stderr, "error: wrong search.\n");
+		search = elapsed(&start);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		if (inline_find_first_occurrence(&inline_list, &missing) != NULL)
+			fprintf(stderr, "error: wrong search.\n");
+		inline_search = elapsed(&start);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		free_inline_linked_list(&inline_list);
+		inline_release = elapsed(&start);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		free_linked_list(&list);
+		release = elapsed(&start);
+
+		printf("%ld,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f\n", size, build / size * 1e9, search / size * 1e9, release / size * 1e9,
+			inline_build / size * 1e9, inline_search / size * 1e9, inline_release / size * 1e9);
+	}
+
+	return EXIT_SUCCESS;
+
+}
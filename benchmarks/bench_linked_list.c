@@ -0,0 +1,675 @@
+/*
+ * Benchmark of every function of linked_list.h.
+ * Build from the root of the repository with the Makefile : make benchmarks/bench_linked_list
+ * or by hand :
+ * 		gcc -O2 -Wl,--wrap=malloc -o bench_linked_list benchmarks/bench_linked_list.c linked_list.c -I.
+ * Usage : ./bench_linked_list [maximum number of elements]
+ * The sizes go from 100 to the maximum (10000000 by default), by powers of 10.
+ * Each size is measured with integer and string data, in a sequential layout (the cells are linked
+ * in the order of their addresses) and in a shuffled layout (the cells and the strings are linked in a random order).
+ * The list holds the values 0, 2, 4 ... : the operations on an occurrence target the middle of the list,
+ * and each insertion is undone by a removal, which is measured too.
+ * The output is CSV : one line per function, with the time and the number of malloc(3) per operation,
+ * and the peak resident set size of the process so far.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include "linked_list.h"
+#include "bench_common.h"
+
+#define MAX_REPETITIONS 1000
+#define CELLS_PER_MEASURE 1000000
+#define STRING_SIZE 24
+
+/*
+ * Count of the calls to malloc(3), thanks to the link option -Wl,--wrap=malloc.
+ */
+static long allocations = 0;
+
+/*
+ * Results of the functions whose result is not used, so they are not optimized away.
+ */
+static volatile size_t sink;
+
+void * __real_malloc(size_t size);
+
+void * __wrap_malloc(size_t size) {
+
+	allocations += 1;
+
+	return __real_malloc(size);
+
+}
+
+/* ------------------------------------------------------------------ data */
+
+void print_string(void *data) {
+	printf("%s ", (char *)data);
+}
+
+int format_string(void *data, char *buffer, size_t size) {
+	return snprintf(buffer, size, "%s", (char *)data);
+}
+
+int cmp_int_reverse(void *data1, void *data2) {
+	return cmp_int(data2, data1);
+}
+
+int cmp_string(void *data1, void *data2) {
+	return strcmp((char *)data1, (char *)data2);
+}
+
+int cmp_string_reverse(void *data1, void *data2) {
+	return strcmp((char *)data2, (char *)data1);
+}
+
+struct payload {
+	const char *name;
+	void (*print_data)(void *data);
+	int (*format_data)(void *data, char *buffer, size_t size);
+	int (*cmp_data)(void *data1, void *data2);
+	int (*cmp_reverse)(void *data1, void *data2);
+	void *sentinel; /* data which is never in the list */
+	void *odd_value; /* data which goes in the middle of the sorted list */
+};
+
+static char odd_string[STRING_SIZE];
+
+static struct payload payloads[] = {
+	{"int", print_int, format_int, cmp_int, cmp_int_reverse, (void *)-1L, NULL},
+	{"string", print_string, format_string, cmp_string, cmp_string_reverse, "sentinel", odd_string}
+};
+
+/* ------------------------------------------------------------------ measures */
+
+struct bench {
+	struct payload *payload;
+	const char *layout;
+	long size;
+	long repetitions; /* number of repetitions of the operations which traverse the list */
+	void **values; /* data of the list, in order */
+	LinkedList *list; /* list of the values, owned by header */
+	LinkedListHeader header;
+	FILE *null_stream;
+	int null_fd;
+};
+
+struct measure {
+	struct timespec start;
+	long start_allocations;
+	double seconds;
+	long allocations;
+	long operations;
+};
+
+void begin(struct measure *measure) {
+
+	measure->start_allocations = allocations;
+	clock_gettime(CLOCK_MONOTONIC, &(measure->start));
+
+}
+
+void end(struct measure *measure, long operations) {
+
+	struct timespec stop;
+
+	clock_gettime(CLOCK_MONOTONIC, &stop);
+	measure->seconds += (stop.tv_sec - measure->start.tv_sec) + (stop.tv_nsec - measure->start.tv_nsec) * 1e-9;
+	measure->allocations += allocations - measure->start_allocations;
+	measure->operations += operations;
+
+}
+
+void report(struct bench *bench, const char *function, struct measure *measure) {
+
+	struct rusage usage;
+
+	getrusage(RUSAGE_SELF, &usage);
+	printf("%s,%s,%s,%ld,%ld,%.2f,%.3f,%ld\n", function, bench->payload->name, bench->layout, bench->size, measure->operations,
+		measure->seconds / measure->operations * 1e9, (double)measure->allocations / measure->operations, usage.ru_maxrss);
+	fflush(stdout);
+
+}
+
+/* ------------------------------------------------------------------ list building */
+
+void shuffle(void **array, long size) {
+
+	long i, j;
+	void *tmp;
+
+	for (i = size - 1; i > 0; i--) {
+		j = (long)(((unsigned long)rand() * ((unsigned long)RAND_MAX + 1) + (unsigned long)rand()) % (unsigned long)(i + 1));
+		tmp = array[i];
+		array[i] = array[j];
+		array[j] = tmp;
+	}
+
+}
+
+/*
+ * This function creates the values 0, 2, 4 ... of the list.
+ * For the strings of the shuffled layout, the buffers get the values in a random order.
+ */
+void ** create_values(struct payload *payload, long size, int shuffled) {
+
+	void **values = malloc(size * sizeof(void *));
+	long i;
+
+	for (i = 0; i < size; i++)
+		values[i] = (payload->cmp_data == cmp_int) ? (void *)(2 * i) : malloc(STRING_SIZE);
+
+	if (payload->cmp_data == cmp_string) {
+		if (shuffled)
+			shuffle(values, size);
+		for (i = 0; i < size; i++)
+			snprintf(values[i], STRING_SIZE, "%012ld", 2 * i);
+		snprintf(odd_string, STRING_SIZE, "%012ld", 2 * (size / 2) + 1);
+	} else {
+		payload->odd_value = (void *)(2 * (size / 2) + 1);
+	}
+
+	return values;
+
+}
+
+void free_values(struct payload *payload, void **values, long size) {
+
+	long i;
+
+	if (payload->cmp_data == cmp_string)
+		for (i = 0; i < size; i++)
+			free(values[i]);
+	free(values);
+
+}
+
+/*
+ * This function links the cells of the list in a random order, with the values still in order.
+ */
+void shuffle_cells(struct bench *bench) {
+
+	void **cells = malloc(bench->size * sizeof(void *));
+	LinkedList *cell;
+	long i;
+
+	for (cell = bench->header.head, i = 0; cell != NULL; cell = cell->next, i++)
+		cells[i] = cell;
+	shuffle(cells, bench->size);
+	for (i = 0; i < bench->size; i++) {
+		((LinkedList *)cells[i])->data = bench->values[i];
+		((LinkedList *)cells[i])->next = (i + 1 < bench->size) ? cells[i + 1] : NULL;
+	}
+	bench->header.head = cells[0];
+	bench->header.tail = cells[bench->size - 1];
+
+	free(cells);
+
+}
+
+/* ------------------------------------------------------------------ operations on LinkedList */
+
+void * middle(struct bench *bench) {
+	return bench->values[bench->size / 2];
+}
+
+void * sentinel(struct bench *bench) {
+	return bench->payload->sentinel;
+}
+
+void op_add_at_the_end(struct bench *bench) {
+	add_at_the_end(&(bench->list), sentinel(bench), bench->payload->print_data, free_nothing);
+}
+
+void op_remove_last_occurrence(struct bench *bench) {
+	remove_last_occurrence(&(bench->list), sentinel(bench), bench->payload->cmp_data);
+}
+
+void op_add_after_first_occurrence(struct bench *bench) {
+	add_after_first_occurrence(&(bench->list), sentinel(bench), bench->payload->print_data, free_nothing, middle(bench), bench->payload->cmp_data);
+}
+
+void op_remove_first_occurrence(struct bench *bench) {
+	remove_first_occurrence(&(bench->list), sentinel(bench), bench->payload->cmp_data);
+}
+
+void op_add_before_first_occurrence(struct bench *bench) {
+	add_before_first_occurrence(&(bench->list), sentinel(bench), bench->payload->print_data, free_nothing, middle(bench), bench->payload->cmp_data);
+}
+
+/*
+ * extract_first_occurrence and extract_last_occurrence return the cell still linked to the rest of the list.
+ */
+void free_extracted(LinkedList *cell) {
+	cell->next = NULL;
+	free_linked_list(&cell);
+}
+
+void op_extract_first_occurrence(struct bench *bench) {
+	free_extracted(extract_first_occurrence(&(bench->list), sentinel(bench), bench->payload->cmp_data));
+}
+
+void op_add_after_last_occurrence(struct bench *bench) {
+	add_after_last_occurrence(&(bench->list), sentinel(bench), bench->payload->print_data, free_nothing, middle(bench), bench->payload->cmp_data);
+}
+
+void op_extract_last_occurrence(struct bench *bench) {
+	free_extracted(extract_last_occurrence(&(bench->list), sentinel(bench), bench->payload->cmp_data));
+}
+
+void op_add_before_last_occurrence(struct bench *bench) {
+	add_before_last_occurrence(&(bench->list), sentinel(bench), bench->payload->print_data, free_nothing, middle(bench), bench->payload->cmp_data);
+}
+
+void op_remove_all_occurrence(struct bench *bench) {
+	remove_all_occurrence(&(bench->list), sentinel(bench), bench->payload->cmp_data);
+}
+
+void op_add_sorted(struct bench *bench) {
+	add_sorted(&(bench->list), bench->payload->odd_value, bench->payload->print_data, free_nothing, bench->payload->cmp_data);
+}
+
+void op_remove_odd_value(struct bench *bench) {
+	remove_first_occurrence(&(bench->list), bench->payload->odd_value, bench->payload->cmp_data);
+}
+
+void op_add_list(struct bench *bench) {
+	static LinkedList cell;
+	cell.data = sentinel(bench);
+	cell.print_data = bench->payload->print_data;
+	cell.free_data = free_nothing;
+	cell.next = NULL;
+	add_list(&(bench->list), &cell);
+}
+
+void op_unlink_last(struct bench *bench) {
+	LinkedList *cell = bench->list;
+	while (cell->next->next != NULL)
+		cell = cell->next;
+	cell->next = NULL;
+}
+
+int is_sentinel(void *data, void *context) {
+	return ((struct bench *)context)->payload->cmp_data(data, sentinel((struct bench *)context)) == 0;
+}
+
+int is_not_sentinel(void *data, void *context) {
+	return !is_sentinel(data, context);
+}
+
+void op_remove_if(struct bench *bench) {
+	remove_if(&(bench->list), is_sentinel, bench);
+}
+
+void op_filter_linked_list(struct bench *bench) {
+	LinkedList *removed = filter_linked_list(&(bench->list), is_not_sentinel, bench);
+	free_linked_list(&removed);
+}
+
+void op_find_first_occurrence(struct bench *bench) {
+	sink = (size_t)find_first_occurrence(bench->list, middle(bench), bench->payload->cmp_data);
+}
+
+void op_find_last_occurrence(struct bench *bench) {
+	sink = (size_t)find_last_occurrence(bench->list, middle(bench), bench->payload->cmp_data);
+}
+
+void op_linked_list_size(struct bench *bench) {
+	sink = linked_list_size(bench->list);
+}
+
+/* ------------------------------------------------------------------ operations on LinkedListHeader */
+
+void op_header_add_after_first_occurrence(struct bench *bench) {
+	header_add_after_first_occurrence(&(bench->header), sentinel(bench), bench->payload->print_data, free_nothing, middle(bench), bench->payload->cmp_data);
+}
+
+void op_header_remove_first_occurrence(struct bench *bench) {
+	header_remove_first_occurrence(&(bench->header), sentinel(bench), bench->payload->cmp_data);
+}
+
+void op_header_add_before_first_occurrence(struct bench *bench) {
+	header_add_before_first_occurrence(&(bench->header), sentinel(bench), bench->payload->print_data, free_nothing, middle(bench), bench->payload->cmp_data);
+}
+
+void op_header_remove_last_occurrence(struct bench *bench) {
+	header_remove_last_occurrence(&(bench->header), sentinel(bench), bench->payload->cmp_data);
+}
+
+void op_header_add_after_last_occurrence(struct bench *bench) {
+	header_add_after_last_occurrence(&(bench->header), sentinel(bench), bench->payload->print_data, free_nothing, middle(bench), bench->payload->cmp_data);
+}
+
+void op_header_extract_first_occurrence(struct bench *bench) {
+	LinkedList *cell = header_extract_first_occurrence(&(bench->header), sentinel(bench), bench->payload->cmp_data);
+	free_linked_list(&cell);
+}
+
+void op_header_add_before_last_occurrence(struct bench *bench) {
+	header_add_before_last_occurrence(&(bench->header), sentinel(bench), bench->payload->print_data, free_nothing, middle(bench), bench->payload->cmp_data);
+}
+
+void op_header_extract_last_occurrence(struct bench *bench) {
+	LinkedList *cell = header_extract_last_occurrence(&(bench->header), sentinel(bench), bench->payload->cmp_data);
+	free_linked_list(&cell);
+}
+
+void op_header_add_list(struct bench *bench) {
+	LinkedListHeader to_add;
+	init_linked_list_header(&to_add);
+	header_add_to_top(&to_add, sentinel(bench), bench->payload->print_data, free_nothing);
+	header_add_list(&(bench->header), &to_add);
+}
+
+void op_header_remove_all_occurrence(struct bench *bench) {
+	header_remove_all_occurrence(&(bench->header), sentinel(bench), bench->payload->cmp_data);
+}
+
+void op_linked_list_header_size(struct bench *bench) {
+	sink = linked_list_header_size(&(bench->header));
+}
+
+/* ------------------------------------------------------------------ printing */
+
+void op_print_linked_list(struct bench *bench) {
+	print_linked_list(bench->list);
+	fflush(stdout);
+}
+
+void op_print_linked_list_with_separator(struct bench *bench) {
+	print_linked_list_with_separator(bench->list, ", ");
+	fflush(stdout);
+}
+
+void op_write_linked_list(struct bench *bench) {
+	write_linked_list(bench->list, bench->null_fd, " ", 0, bench->payload->format_data);
+}
+
+void op_fwrite_linked_list(struct bench *bench) {
+	fwrite_linked_list(bench->list, bench->null_stream, " ", 0, bench->payload->format_data);
+	fflush(bench->null_stream);
+}
+
+/* ------------------------------------------------------------------ drivers */
+
+/*
+ * This function measures an insertion and the removal which undoes it, 'repetitions' times.
+ * If a name is NULL, the operation is done but not reported.
+ */
+void measure_pair(struct bench *bench, const char *insert_name, void (*insert)(struct bench *bench), const char *remove_name, void (*remove)(struct bench *bench)) {
+
+	struct measure inserts = {0}, removes = {0};
+	long i;
+
+	for (i = 0; i < bench->repetitions; i++) {
+		begin(&inserts);
+		insert(bench);
+		end(&inserts, 1);
+		begin(&removes);
+		remove(bench);
+		end(&removes, 1);
+	}
+
+	if (insert_name != NULL)
+		report(bench, insert_name, &inserts);
+	if (remove_name != NULL)
+		report(bench, remove_name, &removes);
+
+}
+
+/*
+ * This function measures an operation which does not modify the list, 'repetitions' times.
+ */
+void measure_repeat(struct bench *bench, const char *name, void (*operation)(struct bench *bench)) {
+
+	struct measure measure = {0};
+	long i;
+
+	begin(&measure);
+	for (i = 0; i < bench->repetitions; i++)
+		operation(bench);
+	end(&measure, bench->repetitions);
+
+	report(bench, name, &measure);
+
+}
+
+/*
+ * This function measures an operation whose output goes to /dev/null, 'repetitions' times.
+ */
+void measure_printing(struct bench *bench, const char *name, void (*operation)(struct bench *bench)) {
+
+	struct measure measure = {0};
+	int saved;
+	long i;
+
+	fflush(stdout);
+	saved = dup(STDOUT_FILENO);
+	dup2(bench->null_fd, STDOUT_FILENO);
+
+	begin(&measure);
+	for (i = 0; i < bench->repetitions; i++)
+		operation(bench);
+	end(&measure, bench->repetitions);
+
+	fflush(stdout);
+	dup2(saved, STDOUT_FILENO);
+	close(saved);
+
+	report(bench, name, &measure);
+
+}
+
+/*
+ * This function measures the functions which handle a whole list : add_to_top, free_linked_list and the pools.
+ */
+void measure_whole_lists(struct bench *bench) {
+
+	struct measure measure;
+	LinkedList *list = NULL;
+	LinkedListPool *pool;
+	long i;
+
+	memset(&measure, 0, sizeof(measure));
+	begin(&measure);
+	for (i = bench->size - 1; i >= 0; i--)
+		add_to_top(&list, bench->values[i], bench->payload->print_data, free_nothing);
+	end(&measure, bench->size);
+	report(bench, "add_to_top", &measure);
+
+	memset(&measure, 0, sizeof(measure));
+	begin(&measure);
+	free_linked_list(&list);
+	end(&measure, bench->size);
+	report(bench, "free_linked_list", &measure);
+
+	memset(&measure, 0, sizeof(measure));
+	begin(&measure);
+	pool = create_linked_list_pool(0);
+	end(&measure, 1);
+	report(bench, "create_linked_list_pool", &measure);
+
+	memset(&measure, 0, sizeof(measure));
+	begin(&measure);
+	use_linked_list_pool(pool);
+	end(&measure, 1);
+	report(bench, "use_linked_list_pool", &measure);
+
+	memset(&measure, 0, sizeof(measure));
+	begin(&measure);
+	for (i = bench->size - 1; i >= 0; i--)
+		add_to_top(&list, bench->values[i], bench->payload->print_data, free_nothing);
+	end(&measure, bench->size);
+	report(bench, "add_to_top_with_pool", &measure);
+
+	memset(&measure, 0, sizeof(measure));
+	begin(&measure);
+	free_linked_list(&list);
+	end(&measure, bench->size);
+	report(bench, "free_linked_list_with_pool", &measure);
+
+	memset(&measure, 0, sizeof(measure));
+	begin(&measure);
+	reset_linked_list_pool(pool);
+	end(&measure, 1);
+	report(bench, "reset_linked_list_pool", &measure);
+
+	use_linked_list_pool(NULL);
+	memset(&measure, 0, sizeof(measure));
+	begin(&measure);
+	free_linked_list_pool(&pool);
+	end(&measure, 1);
+	report(bench, "free_linked_list_pool", &measure);
+
+}
+
+/*
+ * This function measures the sort and the merge of the list, which are restored in the end.
+ */
+void measure_ordering(struct bench *bench) {
+
+	struct measure measure = {0};
+	LinkedList *even = NULL, *odd = NULL, **even_link = &even, **odd_link = &odd, *cell;
+	long i;
+
+	/* sorted in reverse order then in order : the list is the same in the end */
+	begin(&measure);
+	sort_linked_list(&(bench->list), bench->payload->cmp_reverse);
+	sort_linked_list(&(bench->list), bench->payload->cmp_data);
+	end(&measure, 2);
+	report(bench, "sort_linked_list", &measure);
+
+	/* the list is cut in two sorted lists, one cell out of two */
+	for (cell = bench->list, i = 0; cell != NULL; cell = cell->next, i++) {
+		if (i & 1) {
+			*odd_link = cell;
+			odd_link = &(cell->next);
+		} else {
+			*even_link = cell;
+			even_link = &(cell->next);
+		}
+	}
+	*odd_link = NULL;
+	*even_link = NULL;
+
+	memset(&measure, 0, sizeof(measure));
+	begin(&measure);
+	merge_linked_list(&even, odd, bench->payload->cmp_data);
+	end(&measure, 1);
+	report(bench, "merge_linked_list", &measure);
+	bench->list = even;
+
+}
+
+void run(struct bench *bench, int shuffled) {
+
+	struct measure measure = {0};
+	long i;
+
+	bench->layout = shuffled ? "shuffled" : "sequential";
+	bench->values = create_values(bench->payload, bench->size, shuffled);
+	bench->repetitions = CELLS_PER_MEASURE / bench->size;
+	if (bench->repetitions < 1)
+		bench->repetitions = 1;
+	if (bench->repetitions > MAX_REPETITIONS)
+		bench->repetitions = MAX_REPETITIONS;
+
+	measure_whole_lists(bench);
+
+	begin(&measure);
+	init_linked_list_header(&(bench->header));
+	end(&measure, 1);
+	report(bench, "init_linked_list_header", &measure);
+
+	memset(&measure, 0, sizeof(measure));
+	begin(&measure);
+	for (i = 0; i < bench->size; i++)
+		header_add_at_the_end(&(bench->header), bench->values[i], bench->payload->print_data, free_nothing);
+	end(&measure, bench->size);
+	report(bench, "header_add_at_the_end", &measure);
+
+	memset(&measure, 0, sizeof(measure));
+	begin(&measure);
+	for (i = 0; i < bench->repetitions; i++)
+		header_add_to_top(&(bench->header), sentinel(bench), bench->payload->print_data, free_nothing);
+	end(&measure, bench->repetitions);
+	report(bench, "header_add_to_top", &measure);
+	for (i = 0; i < bench->repetitions; i++)
+		header_remove_first_occurrence(&(bench->header), sentinel(bench), bench->payload->cmp_data);
+
+	if (shuffled)
+		shuffle_cells(bench);
+
+	/* the LinkedList functions use the cells of the header, which are the same in the end */
+	bench->list = bench->header.head;
+	measure_pair(bench, "add_at_the_end", op_add_at_the_end, "remove_last_occurrence", op_remove_last_occurrence);
+	measure_pair(bench, "add_after_first_occurrence", op_add_after_first_occurrence, "remove_first_occurrence", op_remove_first_occurrence);
+	measure_pair(bench, "add_before_first_occurrence", op_add_before_first_occurrence, "extract_first_occurrence", op_extract_first_occurrence);
+	measure_pair(bench, "add_after_last_occurrence", op_add_after_last_occurrence, "extract_last_occurrence", op_extract_last_occurrence);
+	measure_pair(bench, "add_before_last_occurrence", op_add_before_last_occurrence, "remove_all_occurrence", op_remove_all_occurrence);
+	measure_pair(bench, "add_sorted", op_add_sorted, NULL, op_remove_odd_value);
+	measure_pair(bench, "add_list", op_add_list, NULL, op_unlink_last);
+	measure_pair(bench, NULL, op_add_after_first_occurrence, "remove_if", op_remove_if);
+	measure_pair(bench, NULL, op_add_after_first_occurrence, "filter_linked_list", op_filter_linked_list);
+	measure_repeat(bench, "find_first_occurrence", op_find_first_occurrence);
+	measure_repeat(bench, "find_last_occurrence", op_find_last_occurrence);
+	measure_repeat(bench, "linked_list_size", op_linked_list_size);
+	measure_printing(bench, "print_linked_list", op_print_linked_list);
+	measure_printing(bench, "print_linked_list_with_separator", op_print_linked_list_with_separator);
+	measure_repeat(bench, "write_linked_list", op_write_linked_list);
+	measure_repeat(bench, "fwrite_linked_list", op_fwrite_linked_list);
+	measure_ordering(bench);
+	bench->header.head = bench->list;
+
+	measure_pair(bench, "header_add_after_first_occurrence", op_header_add_after_first_occurrence, "header_remove_first_occurrence", op_header_remove_first_occurrence);
+	measure_pair(bench, "header_add_before_first_occurrence", op_header_add_before_first_occurrence, "header_remove_last_occurrence", op_header_remove_last_occurrence);
+	measure_pair(bench, "header_add_after_last_occurrence", op_header_add_after_last_occurrence, "header_extract_first_occurrence", op_header_extract_first_occurrence);
+	measure_pair(bench, "header_add_before_last_occurrence", op_header_add_before_last_occurrence, "header_extract_last_occurrence", op_header_extract_last_occurrence);
+	measure_pair(bench, "header_add_list", op_header_add_list, "header_remove_all_occurrence", op_header_remove_all_occurrence);
+	measure_repeat(bench, "linked_list_header_size", op_linked_list_header_size);
+
+	memset(&measure, 0, sizeof(measure));
+	begin(&measure);
+	free_linked_list_header(&(bench->header));
+	end(&measure, bench->size);
+	report(bench, "free_linked_list_header", &measure);
+
+	free_values(bench->payload, bench->values, bench->size);
+
+}
+
+int main(int argc, char *argv[]) {
+
+	long max = (argc > 1) ? atol(argv[1]) : 10000000;
+	struct bench bench;
+	unsigned int p;
+	int shuffled;
+
+	srand(1);
+	bench.null_fd = open("/dev/null", O_WRONLY);
+	bench.null_stream = fdopen(dup(bench.null_fd), "w");
+	if (bench.null_fd < 0 || NULL == bench.null_stream) {
+		fprintf(stderr, "error: cannot open /dev/null.\n");
+		return EXIT_FAILURE;
+	}
+
+	printf("function,payload,layout,size,operations,ns_per_operation,allocations_per_operation,peak_rss_kb\n");
+	for (bench.size = 100; bench.size <= max; bench.size *= 10)
+		for (p = 0; p < sizeof(payloads) / sizeof(payloads[0]); p++)
+			for (shuffled = 0; shuffled <= 1; shuffled++) {
+				bench.payload = &payloads[p];
+				run(&bench, shuffled);
+			}
+
+	fclose(bench.null_stream);
+	close(bench.null_fd);
+
+	return EXIT_SUCCESS;
+
+}
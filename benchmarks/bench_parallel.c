@@ -0,0 +1,77 @@
+/*
+ * linked_list_reduce with a CPU heavy accumulation, with pools of different sizes.
+ * Build from the root of the repository :
+ * 		gcc -O2 -pthread -o bench_parallel benchmarks/bench_parallel.c parallel_linked_list.c linked_list.c -I.
+ * Usage : ./bench_parallel [number of elements] [maximum number of threads]
+ * The output is CSV : total number of threads, time in seconds, speedup against the calling thread alone.
+ * Each result is checked against the sequential one.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "parallel_linked_list.h"
+#include "bench_common.h"
+
+#define ROUNDS 200
+
+/* accumulators are unsigned long values stored in the pointers */
+void * accumulate(void *accumulator, void *data, void *context) {
+
+	unsigned long x = (unsigned long)data;
+	int i;
+
+	(void)context;
+	for (i = 0; i < ROUNDS; i++)
+		x = x * 6364136223846793005UL + 1442695040888963407UL;
+
+	return (void *)((unsigned long)accumulator + (x >> 33));
+
+}
+
+void * combine(void *left, void *right, void *context) {
+
+	(void)context;
+
+	return (void *)((unsigned long)left + (unsigned long)right);
+
+}
+
+int main(int argc, char *argv[]) {
+
+	long size = (argc > 1) ? atol(argv[1]) : 1000000, i;
+	unsigned int max_threads = (argc > 2) ? (unsigned int)atoi(argv[2]) : 8, threads;
+	LinkedList *list = NULL;
+	LinkedListWorkerPool *pool;
+	struct timespec start;
+	void *expected, *result;
+	double sequential, time;
+
+	for (i = 0; i < size; i++)
+		add_to_top(&list, (void *)i, print_int, free_nothing);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	expected = linked_list_reduce(list, accumulate, combine, NULL, NULL);
+	sequential = elapsed(&start);
+
+	printf("threads,seconds,speedup\n");
+	printf("1,%.3f,1.00\n", sequential);
+	for (threads = 2; threads <= max_threads; threads *= 2) {
+		pool = create_linked_list_worker_pool(threads - 1);
+		if (NULL == pool)
+			return EXIT_FAILURE;
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		result = linked_list_reduce(list, accumulate, combine, NULL, pool);
+		time = elapsed(&start);
+		if (result != expected)
+			fprintf(stderr, "error: wrong result with %u threads.\n", threads);
+		printf("%u,%.3f,%.2f\n", threads, time, sequential / time);
+		free_linked_list_worker_pool(&pool);
+	}
+
+	free_linked_list(&list);
+
+	return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,78 @@
+/*
+ * Hand a list of integers to another component : deep copy of a LinkedList against sharing of a PersistentList.
+ * Build from the root of the repository :
+ * 		gcc -O2 -pthread -o bench_persistent benchmarks/bench_persistent.c persistent_list.c linked_list.c linked_list_stats.c -I.
+ * Usage : ./bench_persistent [maximum number of elements]
+ * The deep copy allocates a cell and an int for each element, as the components do today.
+ * The PersistentList is shared in O(1), then the receiver adds an element at its top (no copy),
+ * and removes its last element (copy on write of all the cells before it, but not of the ints).
+ * The output is CSV, in ns per element.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "persistent_list.h"
+#include "bench_common.h"
+
+static const ListType int_type = {print_boxed_int, free_boxed_int, cmp_boxed_int, NULL};
+
+int main(int argc, char *argv[]) {
+
+	long max = (argc > 1) ? atol(argv[1]) : 10000000, size;
+	LinkedList *list, *copy, **tail, *tmp;
+	PersistentList persistent, shared;
+	struct timespec start;
+	double deep_copy, share, push, remove_last;
+	int i, last;
+
+	printf("elements,deep_copy,persistent_share,persistent_add_to_top,persistent_remove_last\n");
+	for (size = 1000; size <= max; size *= 10) {
+		list = NULL;
+		tail = &list;
+		init_persistent_list(&persistent, &int_type);
+		for (i = size - 1; i >= 0; i--) {
+			persistent_add_to_top(&persistent, new_boxed_int(i));
+			add_to_top(tail, new_boxed_int(size - 1 - i), print_boxed_int, free_boxed_int);
+			tail = &((*tail)->next);
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		copy = NULL;
+		tail = &copy;
+		for (tmp = list; tmp != NULL; tmp = tmp->next) {
+			add_to_top(tail, new_boxed_int(*(int *)tmp->data), print_boxed_int, free_boxed_int);
+			tail = &((*tail)->next);
+		}
+		deep_copy = elapsed(&start);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		share_persistent_list(&shared, &persistent);
+		share = elapsed(&start);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		persistent_add_to_top(&shared, new_boxed_int(-1));
+		push = elapsed(&start);
+
+		last = size - 1;
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		if (!persistent_remove_first_occurrence(&shared, &last, NULL))
+			fprintf(stderr, "error: wrong removal.\n");
+		remove_last = elapsed(&start);
+
+		if (persistent_list_size(&persistent) != (size_t)size || persistent_list_size(&shared) != (size_t)size)
+			fprintf(stderr, "error: wrong size.\n");
+
+		free_persistent_list(&shared);
+		free_persistent_list(&persistent);
+		free_linked_list(&copy);
+		free_linked_list(&list);
+
+		printf("%ld,%.2f,%.2f,%.2f,%.2f\n", size, deep_copy / size * 1e9, share / size * 1e9, push / size * 1e9,
+			remove_last / size * 1e9);
+	}
+
+	return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,50 @@
+/*
+ * Throughput of print_linked_list against write_linked_list on a list of integers.
+ * Build from the root of the repository :
+ * 		gcc -O2 -o bench_print benchmarks/bench_print.c linked_list.c -I.
+ * Usage : ./bench_print [number of elements]
+ * Both outputs go to /dev/null, so only the formatting and the calls to the output are measured.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "linked_list.h"
+#include "bench_common.h"
+
+int main(int argc, char *argv[]) {
+
+	LinkedList *list = NULL;
+	long i, size = (argc > 1) ? atol(argv[1]) : 10000000;
+	struct timespec start;
+	double seconds;
+	int fd;
+
+	for (i = size; i > 0; i--)
+		add_to_top(&list, (void *)i, print_int, free_nothing);
+
+	fd = open("/dev/null", O_WRONLY);
+	if (fd < 0 || NULL == freopen("/dev/null", "w", stdout)) {
+		fprintf(stderr, "error: cannot open /dev/null.\n");
+		return EXIT_FAILURE;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	print_linked_list_with_separator(list, " ");
+	fflush(stdout);
+	seconds = elapsed(&start);
+	fprintf(stderr, "print_linked_list_with_separator : %ld elements in %.3f s (%.1f M elements/s)\n", size, seconds, size / seconds / 1e6);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	write_linked_list(list, fd, " ", 1 << 20, format_int);
+	seconds = elapsed(&start);
+	fprintf(stderr, "write_linked_list                : %ld elements in %.3f s (%.1f M elements/s)\n", size, seconds, size / seconds / 1e6);
+
+	close(fd);
+	free_linked_list(&list);
+
+	return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,124 @@
+/*
+ * Startup of a list of strings : rebuild from the source data against the opening of a snapshot.
+ * Build from the root of the repository :
+ * 		gcc -O2 -o bench_snapshot benchmarks/bench_snapshot.c linked_list_snapshot.c linked_list.c -I.
+ * Usage : ./bench_snapshot [maximum number of elements] [snapshot file]
+ * The rebuild copies each string and adds it at the end of a LinkedList (through a tail pointer).
+ * The snapshot is opened with mmap(2) (open), then read until the end (open_and_traverse),
+ * and searched for its last string (find_last), all with the file in the page cache.
+ * The output is CSV, in microseconds.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "linked_list.h"
+#include "linked_list_snapshot.h"
+#include "bench_common.h"
+
+#define STRING_SIZE 32
+
+void print_string(void *data) {
+	printf("%s ", (char *)data);
+}
+
+void free_string(void **data) {
+	free(*data);
+	*data = NULL;
+}
+
+int encode_string(void *data, char *buffer, size_t size) {
+
+	size_t length = strlen((char *)data);
+
+	if (length <= size)
+		memcpy(buffer, data, length);
+
+	return (int)length;
+
+}
+
+int cmp_encoded_string(const void *data, size_t length, const void *target) {
+
+	if (strlen((const char *)target) != length)
+		return 1;
+
+	return memcmp(data, target, length);
+
+}
+
+/*
+ * This function builds the list from the source strings, as a program does at startup.
+ */
+LinkedList * rebuild(char (*source)[STRING_SIZE], long size) {
+
+	LinkedList *list = NULL, **tail = &list;
+	long i;
+
+	for (i = 0; i < size; i++) {
+		if (!add_to_top(tail, strdup(source[i]), print_string, free_string))
+			break;
+		tail = &((*tail)->next);
+	}
+
+	return list;
+
+}
+
+int main(int argc, char *argv[]) {
+
+	long max = (argc > 1) ? atol(argv[1]) : 10000000, size, i;
+	const char *path = (argc > 2) ? argv[2] : "bench_snapshot.bin";
+	char (*source)[STRING_SIZE];
+	LinkedList *list;
+	LinkedListSnapshot snapshot;
+	const LinkedListSnapshotNode *node;
+	struct timespec start;
+	double build, save, open, traverse, find;
+	size_t bytes;
+
+	printf("elements,rebuild,save,open,open_and_traverse,find_last\n");
+	for (size = 1000; size <= max; size *= 10) {
+		source = malloc(size * sizeof(*source));
+		for (i = 0; i < size; i++)
+			snprintf(source[i], STRING_SIZE, "element-%ld", i);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		list = rebuild(source, size);
+		build = elapsed(&start);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		if (!save_linked_list_snapshot(list, path, encode_string))
+			return EXIT_FAILURE;
+		save = elapsed(&start);
+		free_linked_list(&list);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		if (!open_linked_list_snapshot(&snapshot, path))
+			return EXIT_FAILURE;
+		open = elapsed(&start);
+		close_linked_list_snapshot(&snapshot);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		open_linked_list_snapshot(&snapshot, path);
+		for (bytes = 0, node = linked_list_snapshot_first(&snapshot); node != NULL; node = linked_list_snapshot_next(&snapshot, node))
+			bytes += node->length;
+		traverse = elapsed(&start);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		node = snapshot_find_first_occurrence(&snapshot, source[size - 1], cmp_encoded_string);
+		find = elapsed(&start);
+		if (NULL == node || linked_list_snapshot_size(&snapshot) != (size_t)size || 0 == bytes)
+			fprintf(stderr, "error: wrong snapshot.\n");
+		close_linked_list_snapshot(&snapshot);
+
+		printf("%ld,%.1f,%.1f,%.1f,%.1f,%.1f\n", size, build * 1e6, save * 1e6, open * 1e6, traverse * 1e6, find * 1e6);
+		free(source);
+	}
+
+	remove(path);
+
+	return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,76 @@
+/*
+ * sort_linked_list against the round trip through an array sorted with qsort(3).
+ * Build from the root of the repository :
+ * 		gcc -O2 -o bench_sort benchmarks/bench_sort.c linked_list.c -I.
+ * Usage : ./bench_sort [maximum number of elements]
+ * The output is CSV, in ns per element. The lists hold random integers.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "bench_common.h"
+
+int cmp_qsort(const void *data1, const void *data2) {
+	return cmp_int(*(void * const *)data1, *(void * const *)data2);
+}
+
+LinkedList * random_list(long size) {
+
+	LinkedList *list = NULL;
+	long i;
+
+	srand(42);
+	for (i = 0; i < size; i++)
+		add_to_top(&list, (void *)(long)rand(), print_int, free_nothing);
+
+	return list;
+
+}
+
+/* the round trip that sort_linked_list replaces : copy, qsort, then rebuild the list */
+void sort_through_array(LinkedList **list) {
+
+	unsigned int size = linked_list_size(*list), i;
+	void **array = (void **)malloc(size * sizeof(void *));
+	LinkedList *tmp;
+
+	for (i = 0, tmp = *list; tmp != NULL; tmp = tmp->next, i++)
+		array[i] = tmp->data;
+	qsort(array, size, sizeof(void *), cmp_qsort);
+	free_linked_list(list);
+	for (i = size; i > 0; i--)
+		add_to_top(list, array[i - 1], print_int, free_nothing);
+
+	free(array);
+
+}
+
+int main(int argc, char *argv[]) {
+
+	long size, max_size = (argc > 1) ? atol(argv[1]) : 1000000;
+	struct timespec start;
+	double merge, array;
+	LinkedList *list;
+
+	printf("elements,sort_linked_list_ns,array_round_trip_ns\n");
+	for (size = 1000; size <= max_size; size *= 10) {
+		list = random_list(size);
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		sort_linked_list(&list, cmp_int);
+		merge = elapsed(&start) * 1e9 / size;
+		free_linked_list(&list);
+
+		list = random_list(size);
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		sort_through_array(&list);
+		array = elapsed(&start) * 1e9 / size;
+		free_linked_list(&list);
+
+		printf("%ld,%.1f,%.1f\n", size, merge, array);
+	}
+
+	return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,58 @@
+/*
+ * Traversal of a LinkedList against a TypedLinkedList holding the same integers.
+ * Build from the root of the repository :
+ * 		gcc -O2 -o bench_typed benchmarks/bench_typed.c typed_linked_list.c linked_list.c -I.
+ * Usage : ./bench_typed [maximum number of elements]
+ * Each measure is a search of a missing data, so the whole list is traversed.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "typed_linked_list.h"
+#include "bench_common.h"
+
+int main(int argc, char *argv[]) {
+
+	const ListType int_type = { print_int, free_nothing, cmp_int, NULL };
+	long i, size, max_size = (argc > 1) ? atol(argv[1]) : 10000000;
+	int r, rounds;
+	struct timespec start;
+	double classic, typed;
+	void *found = NULL;
+
+	printf("elements,linked_list_ns_per_element,typed_linked_list_ns_per_element,speedup\n");
+	for (size = 1000; size <= max_size; size *= 10) {
+		LinkedListHeader header;
+		TypedLinkedList list;
+
+		init_linked_list_header(&header);
+		init_typed_linked_list(&list, &int_type);
+		for (i = 0; i < size; i++)
+			header_add_at_the_end(&header, (void *)i, print_int, free_nothing);
+		for (i = 0; i < size; i++)
+			typed_add_at_the_end(&list, (void *)i);
+		rounds = (int)(100000000 / size);
+		if (rounds < 3)
+			rounds = 3;
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (r = 0; r < rounds; r++)
+			found = find_first_occurrence(header.head, (void *)-1L, cmp_int);
+		classic = elapsed(&start) * 1e9 / ((double)rounds * size);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (r = 0; r < rounds; r++)
+			found = typed_find_first_occurrence(&list, (void *)-1L, NULL);
+		typed = elapsed(&start) * 1e9 / ((double)rounds * size);
+
+		printf("%ld,%.3f,%.3f,%.2f\n", size, classic, typed, classic / typed);
+
+		free_linked_list_header(&header);
+		free_typed_linked_list(&list);
+	}
+
+	return (NULL == found) ? EXIT_SUCCESS : EXIT_FAILURE;
+
+}
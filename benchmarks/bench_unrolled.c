@@ -0,0 +1,74 @@
+/*
+ * UnrolledLinkedList against LinkedList, for several sizes.
+ * Build from the root of the repository :
+ * 		gcc -O2 -o bench_unrolled benchmarks/bench_unrolled.c unrolled_linked_list.c linked_list.c -I.
+ * Usage : ./bench_unrolled [maximum number of elements]
+ * The output is CSV : building by the end, search of a missing data, and size, in ns per element.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "unrolled_linked_list.h"
+#include "bench_common.h"
+
+int main(int argc, char *argv[]) {
+
+	const ListType int_type = { print_int, NULL, cmp_int, NULL };
+	long i, size, max_size = (argc > 1) ? atol(argv[1]) : 10000000;
+	int r, rounds;
+	struct timespec start;
+	double build[2], find[2], count[2];
+	size_t total = 0;
+
+	printf("elements,linked_list_build_ns,unrolled_build_ns,linked_list_find_ns,unrolled_find_ns,linked_list_size_ns,unrolled_size_ns\n");
+	for (size = 1000; size <= max_size; size *= 10) {
+		LinkedListHeader header;
+		UnrolledLinkedList list;
+
+		rounds = (int)(100000000 / size);
+		if (rounds < 3)
+			rounds = 3;
+
+		init_linked_list_header(&header);
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (i = 0; i < size; i++)
+			header_add_at_the_end(&header, (void *)i, print_int, free_nothing);
+		build[0] = elapsed(&start) * 1e9 / size;
+
+		init_unrolled_linked_list(&list, &int_type);
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (i = 0; i < size; i++)
+			unrolled_add_at_the_end(&list, (void *)i);
+		build[1] = elapsed(&start) * 1e9 / size;
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (r = 0; r < rounds; r++)
+			total += (NULL == find_first_occurrence(header.head, (void *)-1L, cmp_int));
+		find[0] = elapsed(&start) * 1e9 / ((double)rounds * size);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (r = 0; r < rounds; r++)
+			total += (NULL == unrolled_find_first_occurrence(&list, (void *)-1L, NULL));
+		find[1] = elapsed(&start) * 1e9 / ((double)rounds * size);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (r = 0; r < rounds; r++)
+			total += linked_list_size(header.head);
+		count[0] = elapsed(&start) * 1e9 / ((double)rounds * size);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (r = 0; r < rounds; r++)
+			total += unrolled_linked_list_size(&list);
+		count[1] = elapsed(&start) * 1e9 / ((double)rounds * size);
+
+		printf("%ld,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n", size, build[0], build[1], find[0], find[1], count[0], count[1]);
+
+		free_linked_list_header(&header);
+		free_unrolled_linked_list(&list);
+	}
+
+	return (0 == total) ? EXIT_FAILURE : EXIT_SUCCESS;
+
+}
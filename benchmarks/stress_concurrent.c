@@ -0,0 +1,276 @@
+/*
+ * Stress test of the lists shared between threads : concurrent_linked_list.h, epoch_linked_list.h and parallel_linked_list.h.
+ * Build and run from the root of the repository :
+ * 		make stress
+ * Under ThreadSanitizer or AddressSanitizer :
+ * 		make clean && make stress CC="gcc -fsanitize=thread -g"
+ * 		make clean && make stress CC="gcc -fsanitize=address -g"
+ * Usage : ./stress_concurrent [number of operations per thread] [number of threads]
+ * Each part checks its results, and every cell is freed at the end, so a leak checker reports nothing.
+ * It prints one line per part, and returns EXIT_FAILURE at the first wrong result.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "linked_list.h"
+#include "concurrent_linked_list.h"
+#include "epoch_linked_list.h"
+#include "parallel_linked_list.h"
+#include "bench_common.h"
+
+#define MAX_THREADS 64
+
+static const ListType int_type = {print_boxed_int, free_boxed_int, cmp_boxed_int, NULL};
+
+struct concurrent_part {
+	ConcurrentLinkedList list;
+	long count; /* additions per producer */
+	atomic_int producers; /* producers still running */
+	long taken; /* data taken by the consumer */
+	long sum; /* sum of the data taken by the consumer */
+};
+
+void * produce(void *argument) {
+
+	struct concurrent_part *part = (struct concurrent_part *)argument;
+	long i;
+
+	for (i = 1; i <= part->count; i++) {
+		if (!concurrent_add_to_top(&(part->list), new_boxed_int(i), print_boxed_int, free_boxed_int))
+			exit(EXIT_FAILURE);
+	}
+	atomic_fetch_sub_explicit(&(part->producers), 1, memory_order_release);
+
+	return NULL;
+
+}
+
+/*
+ * The consumer takes the cells while the producers add, and gives them back to be reused.
+ */
+void * consume(void *argument) {
+
+	struct concurrent_part *part = (struct concurrent_part *)argument;
+	LinkedList *cells, *tmp;
+	int last;
+
+	do {
+		last = (0 == atomic_load_explicit(&(part->producers), memory_order_acquire));
+		cells = concurrent_take_all(&(part->list));
+		for (tmp = cells; tmp != NULL; tmp = tmp->next) {
+			part->taken += 1;
+			part->sum += *(int *)tmp->data;
+		}
+		concurrent_release_cells(&cells);
+	} while (!last);
+
+	return NULL;
+
+}
+
+int stress_concurrent(long count, int threads) {
+
+	struct concurrent_part part;
+	pthread_t id[MAX_THREADS], consumer;
+	int i;
+
+	init_concurrent_linked_list(&(part.list));
+	part.count = count;
+	atomic_init(&(part.producers), threads);
+	part.taken = 0;
+	part.sum = 0;
+
+	pthread_create(&consumer, NULL, consume, &part);
+	for (i = 0; i < threads; i++)
+		pthread_create(&id[i], NULL, produce, &part);
+	for (i = 0; i < threads; i++)
+		pthread_join(id[i], NULL);
+	pthread_join(consumer, NULL);
+
+	free_concurrent_linked_list(&(part.list));
+	concurrent_free_released_cells();
+
+	printf("concurrent_linked_list: %ld data taken\n", part.taken);
+
+	return part.taken == count * threads && part.sum == threads * (count * (count + 1) / 2);
+
+}
+
+struct epoch_part {
+	EpochLinkedList list;
+	long count; /* removals done by the writer */
+	int keys; /* the data are in [0, keys[ */
+	atomic_int writing; /* 1 while the writer runs */
+	atomic_long found; /* data found by the readers */
+};
+
+/*
+ * The writer replaces the data one by one, so the readers always walk on cells being unlinked and freed.
+ */
+void * write_epoch(void *argument) {
+
+	struct epoch_part *part = (struct epoch_part *)argument;
+	long i;
+	int key;
+
+	for (i = 0; i < part->count; i++) {
+		key = (int)(i % part->keys);
+		if (!epoch_remove_first_occurrence(&(part->list), &key, NULL) || !epoch_add_at_the_end(&(part->list), new_boxed_int(key)))
+			exit(EXIT_FAILURE);
+	}
+	atomic_store_explicit(&(part->writing), 0, memory_order_release);
+
+	return NULL;
+
+}
+
+/*
+ * The readers read the data of the cells they find, so a cell freed too soon is seen by AddressSanitizer.
+ */
+void * read_epoch(void *argument) {
+
+	struct epoch_part *part = (struct epoch_part *)argument;
+	EpochReader *reader = epoch_register_reader(&(part->list));
+	EpochCell *cell;
+	long found = 0;
+	int key = 0;
+
+	if (NULL == reader)
+		exit(EXIT_FAILURE);
+
+	while (atomic_load_explicit(&(part->writing), memory_order_acquire)) {
+		epoch_enter(reader);
+		cell = epoch_find_first_occurrence(reader, &key, NULL);
+		if (cell != NULL && *(int *)cell->data == key)
+			found += 1;
+		epoch_exit(reader);
+		key = (key + 1) % part->keys;
+	}
+	epoch_unregister_reader(reader);
+	atomic_fetch_add_explicit(&(part->found), found, memory_order_relaxed);
+
+	return NULL;
+
+}
+
+int stress_epoch(long count, int threads) {
+
+	struct epoch_part part;
+	pthread_t id[MAX_THREADS], writer;
+	long i;
+	int j;
+
+	if (!init_epoch_linked_list(&(part.list), &int_type))
+		return 0;
+	part.count = count;
+	part.keys = 64;
+	atomic_init(&(part.writing), 1);
+	atomic_init(&(part.found), 0);
+	for (i = 0; i < part.keys; i++) {
+		if (!epoch_add_at_the_end(&(part.list), new_boxed_int(i)))
+			return 0;
+	}
+
+	for (j = 0; j < threads; j++)
+		pthread_create(&id[j], NULL, read_epoch, &part);
+	pthread_create(&writer, NULL, write_epoch, &part);
+	pthread_join(writer, NULL);
+	for (j = 0; j < threads; j++)
+		pthread_join(id[j], NULL);
+
+	i = (long)epoch_linked_list_size(&(part.list));
+	free_epoch_linked_list(&(part.list));
+
+	printf("epoch_linked_list: %ld data found by the readers\n", atomic_load(&(part.found)));
+
+	return i == part.keys;
+
+}
+
+void * double_int(void *data, void *context) {
+
+	(void)context;
+
+	return new_boxed_int(*(int *)data * 2);
+
+}
+
+void * add_int(void *accumulator, void *data, void *context) {
+
+	(void)context;
+
+	return (void *)((long)accumulator + *(int *)data);
+
+}
+
+void * add_accumulators(void *left, void *right, void *context) {
+
+	(void)context;
+
+	return (void *)((long)left + (long)right);
+
+}
+
+/*
+ * The calling thread uses a LinkedListPool, which the workers must not share.
+ */
+int stress_parallel(long count, int threads) {
+
+	LinkedListWorkerPool *workers = create_linked_list_worker_pool(threads);
+	LinkedListPool *pool = create_linked_list_pool(0), *previous;
+	LinkedList *list = NULL, *mapped, *tmp;
+	long i, sum, expected = count * (count - 1) / 2;
+	int round, ok = 1;
+
+	if (NULL == workers || NULL == pool)
+		return 0;
+
+	previous = use_linked_list_pool(pool);
+	for (i = count - 1; i >= 0; i--) {
+		if (!add_to_top(&list, new_boxed_int(i), print_boxed_int, free_boxed_int))
+			return 0;
+	}
+	for (round = 0; round < 8 && ok; round++) {
+		mapped = NULL;
+		if (!linked_list_map(list, &mapped, double_int, NULL, print_boxed_int, free_boxed_int, workers))
+			return 0;
+		for (tmp = mapped, i = 0; tmp != NULL; tmp = tmp->next, i++)
+			ok &= (*(int *)tmp->data == 2 * i);
+		ok &= (i == count);
+		free_linked_list(&mapped);
+		sum = (long)linked_list_reduce(list, add_int, add_accumulators, NULL, workers);
+		ok &= (sum == expected);
+	}
+	free_linked_list(&list);
+	use_linked_list_pool(previous);
+	free_linked_list_pool(&pool);
+	free_linked_list_worker_pool(&workers);
+
+	printf("parallel_linked_list: %d rounds of map and reduce\n", round);
+
+	return ok;
+
+}
+
+int main(int argc, char *argv[]) {
+
+	long count = (argc > 1) ? atol(argv[1]) : 100000;
+	int threads = (argc > 2) ? atoi(argv[2]) : 4;
+
+	/* the data are ints, and linked_list_map doubles them */
+	if (threads < 1 || threads > MAX_THREADS || count < 1 || count > INT_MAX / 2) {
+		fprintf(stderr, "usage: %s [number of operations per thread] [number of threads, at most %d]\n", argv[0], MAX_THREADS);
+		return EXIT_FAILURE;
+	}
+
+	if (!stress_concurrent(count, threads) || !stress_epoch(count, threads) || !stress_parallel(count, threads)) {
+		fprintf(stderr, "error: wrong result.\n");
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+
+}
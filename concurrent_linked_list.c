@@ -0,0 +1,193 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "concurrent_linked_list.h"
+
+
+/*
+ * Cells given back with concurrent_release_cells, shared by all the threads.
+ * Only two operations are done on this stack : pushing a whole chain with a compare-and-swap,
+ * and detaching the whole stack with an exchange.
+ * No thread ever pops a single cell from a shared head, so a cell reused while another thread
+ * holds its address cannot break the stack (ABA problem) : a thread only reads the cells it owns.
+ * The cells are only freed by concurrent_free_released_cells.
+ */
+static _Atomic(LinkedList *) released_cells = NULL;
+
+/*
+ * Cells owned by the calling thread, refilled by detaching the whole released_cells stack.
+ * When the thread ends, its remaining cells are given back to released_cells.
+ */
+struct _cell_cache {
+	LinkedList *cells; /* cells ready to be used by the calling thread */
+	int registered; /* 1 if the thread destructor is set */
+};
+
+static _Thread_local struct _cell_cache cell_cache = {NULL, 0};
+
+static pthread_key_t cache_key;
+
+static pthread_once_t cache_key_once = PTHREAD_ONCE_INIT;
+
+/*
+ * This function pushes the chain from first to last on released_cells.
+ */
+static void push_released_chain(LinkedList *first, LinkedList *last) {
+
+	LinkedList *head = atomic_load_explicit(&released_cells, memory_order_relaxed);
+
+	do {
+		last->next = head;
+	} while (!atomic_compare_exchange_weak_explicit(&released_cells, &head, first, memory_order_release, memory_order_relaxed));
+
+}
+
+/*
+ * This function gives back the cells of an ending thread.
+ */
+static void release_cache(void *value) {
+
+	struct _cell_cache *cache = (struct _cell_cache *)value;
+	LinkedList *last = cache->cells;
+
+	if (NULL == last)
+		return;
+
+	while (last->next != NULL)
+		last = last->next;
+	push_released_chain(cache->cells, last);
+	cache->cells = NULL;
+
+}
+
+static void create_cache_key(void) {
+
+	pthread_key_create(&cache_key, release_cache);
+
+}
+
+/*
+ * This function returns a cell owned by the calling thread, or NULL if there were an allocation problem.
+ */
+static LinkedList * take_cell(void) {
+
+	LinkedList *cell = cell_cache.cells;
+
+	if (NULL == cell) {
+		cell = atomic_exchange_explicit(&released_cells, NULL, memory_order_acquire);
+		if (NULL == cell) {
+			cell = (LinkedList *)malloc(sizeof(LinkedList));
+			if (NULL == cell)
+				fprintf(stderr, "error: allocation fail.\n");
+			return cell;
+		}
+		if (!cell_cache.registered) {
+			pthread_once(&cache_key_once, create_cache_key);
+			pthread_setspecific(cache_key, &cell_cache);
+			cell_cache.registered = 1;
+		}
+	}
+
+	cell_cache.cells = cell->next;
+
+	return cell;
+
+}
+
+/*
+ * This function initializes list as an empty list.
+ */
+void init_concurrent_linked_list(ConcurrentLinkedList *list) {
+
+	atomic_init(&(list->head), NULL);
+
+}
+
+/*
+ * This function frees all the cells of list, with their data.
+ */
+void free_concurrent_linked_list(ConcurrentLinkedList *list) {
+
+	LinkedList *cells = concurrent_take_all(list);
+
+	free_linked_list(&cells);
+
+}
+
+/*
+ * This function add on the top of list the data in parameters, without lock.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int concurrent_add_to_top(ConcurrentLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data)) {
+
+	LinkedList *cell = take_cell(), *head;
+
+	if (NULL == cell)
+		return 0;
+
+	cell->data = data;
+	cell->print_data = print_data;
+	cell->free_data = free_data;
+
+	head = atomic_load_explicit(&(list->head), memory_order_relaxed);
+	do {
+		cell->next = head;
+	} while (!atomic_compare_exchange_weak_explicit(&(list->head), &head, cell, memory_order_release, memory_order_relaxed));
+
+	return 1;
+
+}
+
+/*
+ * This function detaches all the cells of list in one atomic operation, and returns them.
+ */
+LinkedList * concurrent_take_all(ConcurrentLinkedList *list) {
+
+	return atomic_exchange_explicit(&(list->head), NULL, memory_order_acquire);
+
+}
+
+/*
+ * This function frees the data of all the cells, and keeps the cells to be reused by concurrent_add_to_top.
+ */
+void concurrent_release_cells(LinkedList **cells) {
+
+	LinkedList *last = *cells;
+
+	if (NULL == last)
+		return;
+
+	while (1) {
+		if (last->free_data != NULL)
+			last->free_data(&(last->data));
+		if (NULL == last->next)
+			break;
+		last = last->next;
+	}
+
+	push_released_chain(*cells, last);
+	*cells = NULL;
+
+}
+
+/*
+ * This function frees the cells kept by the calling thread and the cells of released_cells.
+ */
+void concurrent_free_released_cells(void) {
+
+	LinkedList *cells[2], *tmp;
+	int i;
+
+	cells[0] = cell_cache.cells;
+	cell_cache.cells = NULL;
+	cells[1] = atomic_exchange_explicit(&released_cells, NULL, memory_order_acquire);
+
+	for (i = 0; i < 2; i++) {
+		while ((tmp = cells[i]) != NULL) {
+			cells[i] = tmp->next;
+			free(tmp);
+		}
+	}
+
+}
@@ -0,0 +1,105 @@
+#ifndef HEADER_CONCURRENT_LINKED_LIST_H_
+#define HEADER_CONCURRENT_LINKED_LIST_H_
+
+#include <stdatomic.h>
+#include "linked_list.h"
+
+
+struct _concurrent_linked_list {
+	_Atomic(LinkedList *) head; /* pointer to the last cell added, or NULL */
+};
+/*
+ * List shared by several producer threads without any lock.
+ * The producers only add to the top with a compare-and-swap on head,
+ * and a consumer detaches the whole chain at once with concurrent_take_all.
+ * The cells are usual LinkedList cells : the detached chain is handled with the functions of linked_list.h.
+ */
+
+typedef struct _concurrent_linked_list ConcurrentLinkedList;
+
+
+/*
+ * @Function init_concurrent_linked_list
+ * @Params
+ * 		ConcurrentLinkedList *list
+ * 		# ConcurrentLinkedList to initialize #
+ * @Return void
+ * @Description
+ * 		This function initializes list as an empty list.
+ * 		It must be called before list is shared between threads.
+ */
+extern void init_concurrent_linked_list(ConcurrentLinkedList *list);
+
+/*
+ * @Function free_concurrent_linked_list
+ * @Params
+ * 		ConcurrentLinkedList *list
+ * 		# ConcurrentLinkedList which will be modified #
+ * @Return void
+ * @Description
+ * 		This function detaches all the cells of list and frees them, with their data, like free_linked_list.
+ * 		No other thread may use list during the call.
+ */
+extern void free_concurrent_linked_list(ConcurrentLinkedList *list);
+
+/*
+ * @Function concurrent_add_to_top
+ * @Params
+ * 		ConcurrentLinkedList *list
+ * 		# ConcurrentLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add on the top of list the data in parameters, without lock : it can be called by several threads at the same time.
+ * 		The cell is taken from the cells given back with concurrent_release_cells, or allocated with malloc(3).
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int concurrent_add_to_top(ConcurrentLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data));
+
+/*
+ * @Function concurrent_take_all
+ * @Params
+ * 		ConcurrentLinkedList *list
+ * 		# ConcurrentLinkedList which will be modified #
+ * @Return LinkedList * # all the cells of list, or NULL #
+ * @Description
+ * 		This function detaches all the cells of list in one atomic operation, and returns them as a LinkedList.
+ * 		The last data added is the first of the returned LinkedList.
+ * 		list is empty after the call, and can still be used by the producers.
+ */
+extern LinkedList * concurrent_take_all(ConcurrentLinkedList *list);
+
+/*
+ * @Function concurrent_release_cells
+ * @Params
+ * 		LinkedList **cells
+ * 		# LinkedList returned by concurrent_take_all #
+ * @Return void
+ * @Description
+ * 		This function frees the data of all the cells, like free_linked_list, but keeps the cells to be reused by concurrent_add_to_top.
+ * 		The cells must have been allocated with malloc(3) : the cells of a pool cannot be released.
+ * 		At the end of the function, *cells is NULL.
+ */
+extern void concurrent_release_cells(LinkedList **cells);
+
+/*
+ * @Function concurrent_free_released_cells
+ * @Params
+ * 		void
+ * @Return void
+ * @Description
+ * 		This function frees the cells kept for concurrent_add_to_top by the calling thread,
+ * 		and the cells given back by concurrent_release_cells or by the threads which ended.
+ * 		The cells kept by the other running threads are not freed : they are given back when these threads end.
+ * 		It can be called at any time, for example at the end of the program, when the other threads have been joined.
+ */
+extern void concurrent_free_released_cells(void);
+
+
+#endif /* HEADER_CONCURRENT_LINKED_LIST_H_ */
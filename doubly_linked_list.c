@@ -0,0 +1,407 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "doubly_linked_list.h"
+
+
+/*
+ * This function links a new cell between previous and next in list.
+ * previous (or next) is NULL when the cell becomes the head (or the tail) of list.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+static int link_between(DoublyLinkedList *list, DoublyCell *previous, DoublyCell *next, void *data) {
+
+	DoublyCell *cell = NULL;
+
+	cell = (DoublyCell *)malloc(sizeof(DoublyCell));
+	if (NULL == cell) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return 0;
+	}
+
+	cell->data = data;
+	cell->previous = previous;
+	cell->next = next;
+	if (NULL == previous)
+		list->head = cell;
+	else
+		previous->next = cell;
+	if (NULL == next)
+		list->tail = cell;
+	else
+		next->previous = cell;
+	list->size += 1;
+
+	return 1;
+
+}
+
+/*
+ * This function unlinks cell from list.
+ * It returns cell, whose 'previous' and 'next' fields are the NULL pointer.
+ */
+static DoublyCell * unlink_cell(DoublyLinkedList *list, DoublyCell *cell) {
+
+	if (NULL == cell->previous)
+		list->head = cell->next;
+	else
+		cell->previous->next = cell->next;
+	if (NULL == cell->next)
+		list->tail = cell->previous;
+	else
+		cell->next->previous = cell->previous;
+	list->size -= 1;
+	cell->previous = NULL;
+	cell->next = NULL;
+
+	return cell;
+
+}
+
+/*
+ * This function search the first occurrence of reference from the head of list.
+ * It returns the cell where the function found reference, or NULL.
+ */
+static DoublyCell * search_forward(const DoublyLinkedList *list, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	DoublyCell *tmp = list->head;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	while (tmp != NULL && cmp_data(tmp->data, reference) != 0)
+		tmp = tmp->next;
+
+	return tmp;
+
+}
+
+/*
+ * This function search the last occurrence of reference from the tail of list.
+ * It returns the cell where the function found reference, or NULL.
+ */
+static DoublyCell * search_backward(const DoublyLinkedList *list, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	DoublyCell *tmp = list->tail;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	while (tmp != NULL && cmp_data(tmp->data, reference) != 0)
+		tmp = tmp->previous;
+
+	return tmp;
+
+}
+
+/*
+ * This function initializes list as an empty list of data of the given type.
+ */
+void init_doubly_linked_list(DoublyLinkedList *list, const ListType *type) {
+
+	list->type = type;
+	list->head = NULL;
+	list->tail = NULL;
+	list->size = 0;
+
+}
+
+/*
+ * This function frees all the cells of list, and their data if free_data is not NULL.
+ * At the end of the function, list is an empty list.
+ */
+void free_doubly_linked_list(DoublyLinkedList *list) {
+
+	DoublyCell *tmp = list->head, *save;
+
+	while (tmp != NULL) {
+		save = tmp->next;
+		if (list->type->free_data != NULL)
+			list->type->free_data(&(tmp->data));
+		free(tmp);
+		tmp = save;
+	}
+
+	init_doubly_linked_list(list, list->type);
+
+}
+
+/*
+ * This function displays all the list on the console, followed by a new line.
+ * WARNING : the print_data function cannot be NULL.
+ */
+void print_doubly_linked_list(const DoublyLinkedList *list) {
+
+	DoublyCell *tmp;
+
+	for (tmp = list->head; tmp != NULL; tmp = tmp->next)
+		list->type->print_data(tmp->data);
+
+	printf("\n");
+
+}
+
+/*
+ * This function add to the top of list the data in parameters, in O(1).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int doubly_add_to_top(DoublyLinkedList *list, void *data) {
+
+	return link_between(list, NULL, list->head, data);
+
+}
+
+/*
+ * This function add at the end of list the data in parameters, in O(1).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int doubly_add_at_the_end(DoublyLinkedList *list, void *data) {
+
+	return link_between(list, list->tail, NULL, data);
+
+}
+
+/*
+ * This function add after cell the data in parameters, in O(1).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int doubly_add_after_cell(DoublyLinkedList *list, void *data, DoublyCell *cell) {
+
+	return link_between(list, cell, cell->next, data);
+
+}
+
+/*
+ * This function add before cell the data in parameters, in O(1).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int doubly_add_before_cell(DoublyLinkedList *list, void *data, DoublyCell *cell) {
+
+	return link_between(list, cell->previous, cell, data);
+
+}
+
+/*
+ * This function add after the first occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int doubly_add_after_first_occurrence(DoublyLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	DoublyCell *cell;
+
+	if (NULL == reference)
+		return doubly_add_at_the_end(list, data);
+
+	cell = search_forward(list, reference, cmp_data);
+	if (NULL == cell) {
+		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+		return 0;
+	}
+
+	return doubly_add_after_cell(list, data, cell);
+
+}
+
+/*
+ * This function add before the first occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int doubly_add_before_first_occurrence(DoublyLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	DoublyCell *cell;
+
+	if (NULL == reference)
+		return doubly_add_at_the_end(list, data);
+
+	cell = search_forward(list, reference, cmp_data);
+	if (NULL == cell) {
+		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
+		return 0;
+	}
+
+	return doubly_add_before_cell(list, data, cell);
+
+}
+
+/*
+ * This function add after the last occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int doubly_add_after_last_occurrence(DoublyLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	DoublyCell *cell;
+
+	if (NULL == reference)
+		return doubly_add_at_the_end(list, data);
+
+	cell = search_backward(list, reference, cmp_data);
+	if (NULL == cell) {
+		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+		return 0;
+	}
+
+	return doubly_add_after_cell(list, data, cell);
+
+}
+
+/*
+ * This function add before the last occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int doubly_add_before_last_occurrence(DoublyLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	DoublyCell *cell;
+
+	if (NULL == reference)
+		return doubly_add_at_the_end(list, data);
+
+	cell = search_backward(list, reference, cmp_data);
+	if (NULL == cell) {
+		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
+		return 0;
+	}
+
+	return doubly_add_before_cell(list, data, cell);
+
+}
+
+/*
+ * This function remove cell from list, in O(1).
+ * The cell is freed but not its data.
+ */
+void doubly_remove_cell(DoublyLinkedList *list, DoublyCell *cell) {
+
+	free(unlink_cell(list, cell));
+
+}
+
+/*
+ * This function remove the first occurrence of target_data in list.
+ * The cell is freed but not its data.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int doubly_remove_first_occurrence(DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	DoublyCell *cell = search_forward(list, target_data, cmp_data);
+
+	if (NULL == cell)
+		return 0;
+
+	doubly_remove_cell(list, cell);
+
+	return 1;
+
+}
+
+/*
+ * This function remove the last occurrence of target_data in list.
+ * The cell is freed but not its data.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int doubly_remove_last_occurrence(DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	DoublyCell *cell = search_backward(list, target_data, cmp_data);
+
+	if (NULL == cell)
+		return 0;
+
+	doubly_remove_cell(list, cell);
+
+	return 1;
+
+}
+
+/*
+ * This function remove all occurrences of target_data in list, in one pass.
+ * The cells are freed but not their data.
+ * It returns the number of removed elements.
+ */
+size_t doubly_remove_all_occurrence(DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	DoublyCell *tmp = list->head, *save;
+	size_t count = 0;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	while (tmp != NULL) {
+		save = tmp->next;
+		if (cmp_data(tmp->data, target_data) == 0) {
+			doubly_remove_cell(list, tmp);
+			count += 1;
+		}
+		tmp = save;
+	}
+
+	return count;
+
+}
+
+/*
+ * This function extract the first occurrence of target_data in list.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+DoublyCell * doubly_extract_first_occurrence(DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	DoublyCell *cell = search_forward(list, target_data, cmp_data);
+
+	if (NULL == cell)
+		return NULL;
+
+	return unlink_cell(list, cell);
+
+}
+
+/*
+ * This function extract the last occurrence of target_data in list.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+DoublyCell * doubly_extract_last_occurrence(DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	DoublyCell *cell = search_backward(list, target_data, cmp_data);
+
+	if (NULL == cell)
+		return NULL;
+
+	return unlink_cell(list, cell);
+
+}
+
+/*
+ * This function search the first occurrence of target_data in list.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+DoublyCell * doubly_find_first_occurrence(const DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	return search_forward(list, target_data, cmp_data);
+
+}
+
+/*
+ * This function search the last occurrence of target_data in list.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+DoublyCell * doubly_find_last_occurrence(const DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	return search_backward(list, target_data, cmp_data);
+
+}
+
+/*
+ * This function returns the number of elements in list, in O(1).
+ */
+size_t doubly_linked_list_size(const DoublyLinkedList *list) {
+
+	return list->size;
+
+}
@@ -0,0 +1,381 @@
+#ifndef HEADER_DOUBLY_LINKED_LIST_H_
+#define HEADER_DOUBLY_LINKED_LIST_H_
+
+#include <stddef.h>
+#include "list_type.h"
+
+
+struct _doubly_cell {
+	void *data; /* data of the cell */
+	struct _doubly_cell *previous; /* pointer to the previous cell of the structure */
+	struct _doubly_cell *next; /* pointer to the next cell of the structure */
+};
+/*
+ * Cell of a DoublyLinkedList.
+ */
+
+typedef struct _doubly_cell DoublyCell;
+
+struct _doubly_linked_list {
+	const ListType *type; /* functions shared by all the data of the list */
+	DoublyCell *head; /* first cell of the list */
+	DoublyCell *tail; /* last cell of the list */
+	size_t size; /* number of cells in the list */
+};
+/*
+ * Doubly linked list : each cell knows the cell before it.
+ * The "last occurrence" functions search backward from the tail, so they are fast when the match is near the end,
+ * and a known cell is removed, or gets a data added before it, in O(1).
+ */
+
+typedef struct _doubly_linked_list DoublyLinkedList;
+
+
+/*
+ * @Function init_doubly_linked_list
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList to initialize #
+ * 		const ListType *type
+ * 		# functions shared by all the data of the list #
+ * @Return void
+ * @Description
+ * 		This function initializes list as an empty list of data of the given type.
+ */
+extern void init_doubly_linked_list(DoublyLinkedList *list, const ListType *type);
+
+/*
+ * @Function free_doubly_linked_list
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList to free #
+ * @Return void
+ * @Description
+ * 		This function frees all the cells of list, and their data with the free_data of the ListType.
+ * 		If free_data is NULL, the data are not freed.
+ * 		At the end of the function, list is an empty list.
+ */
+extern void free_doubly_linked_list(DoublyLinkedList *list);
+
+/*
+ * @Function print_doubly_linked_list
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList to read #
+ * @Return void
+ * @Description
+ * 		This function displays all the list on the console, followed by a new line.
+ * 		WARNING : the print_data of the ListType cannot be NULL.
+ */
+extern void print_doubly_linked_list(const DoublyLinkedList *list);
+
+/*
+ * @Function doubly_add_to_top
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add to the top of list the data in parameters, in O(1).
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int doubly_add_to_top(DoublyLinkedList *list, void *data);
+
+/*
+ * @Function doubly_add_at_the_end
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add at the end of list the data in parameters, in O(1).
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int doubly_add_at_the_end(DoublyLinkedList *list, void *data);
+
+/*
+ * @Function doubly_add_after_cell
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		DoublyCell *cell
+ * 		# cell of list to add data after it #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add after cell the data in parameters, in O(1).
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int doubly_add_after_cell(DoublyLinkedList *list, void *data, DoublyCell *cell);
+
+/*
+ * @Function doubly_add_before_cell
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		DoublyCell *cell
+ * 		# cell of list to add data before it #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add before cell the data in parameters, in O(1).
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int doubly_add_before_cell(DoublyLinkedList *list, void *data, DoublyCell *cell);
+
+/*
+ * @Function doubly_add_after_first_occurrence
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference
+ * 		# data reference to add data after it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add after the first occurrence of reference in list, the data in parameters.
+ * 		The search starts from the head of list.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int doubly_add_after_first_occurrence(DoublyLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function doubly_add_before_first_occurrence
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference
+ * 		# data reference to add data before it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add before the first occurrence of reference in list, the data in parameters.
+ * 		The search starts from the head of list.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int doubly_add_before_first_occurrence(DoublyLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function doubly_add_after_last_occurrence
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference
+ * 		# data reference to add data after it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add after the last occurrence of reference in list, the data in parameters.
+ * 		The search starts from the tail of list and stops at the first match.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int doubly_add_after_last_occurrence(DoublyLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function doubly_add_before_last_occurrence
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference
+ * 		# data reference to add data before it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add before the last occurrence of reference in list, the data in parameters.
+ * 		The search starts from the tail of list and stops at the first match.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int doubly_add_before_last_occurrence(DoublyLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function doubly_remove_cell
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		DoublyCell *cell
+ * 		# cell of list to remove #
+ * @Return void
+ * @Description
+ * 		This function remove cell from list, in O(1).
+ * 		Like remove_first_occurrence, the cell is freed but not its data.
+ */
+extern void doubly_remove_cell(DoublyLinkedList *list, DoublyCell *cell);
+
+/*
+ * @Function doubly_remove_first_occurrence
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function remove the first occurrence of target_data in list.
+ * 		The search starts from the head of list.
+ * 		Like remove_first_occurrence, the cell is freed but not its data.
+ * 		If target_data has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int doubly_remove_first_occurrence(DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function doubly_remove_last_occurrence
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function remove the last occurrence of target_data in list.
+ * 		The search starts from the tail of list and stops at the first match.
+ * 		Like remove_last_occurrence, the cell is freed but not its data.
+ * 		If target_data has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int doubly_remove_last_occurrence(DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function doubly_remove_all_occurrence
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return size_t # number of removed elements #
+ * @Description
+ * 		This function remove all occurrences of target_data in list, in one pass.
+ * 		The cells are freed but not their data.
+ */
+extern size_t doubly_remove_all_occurrence(DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function doubly_extract_first_occurrence
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return DoublyCell * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function remove the first occurrence of target_data in list, and returns its cell.
+ * 		The search starts from the head of list.
+ * 		The 'previous' and 'next' fields of the returned cell are the NULL pointer, and the cell must be freed with free(3).
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern DoublyCell * doubly_extract_first_occurrence(DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function doubly_extract_last_occurrence
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return DoublyCell * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function remove the last occurrence of target_data in list, and returns its cell.
+ * 		The search starts from the tail of list and stops at the first match.
+ * 		The 'previous' and 'next' fields of the returned cell are the NULL pointer, and the cell must be freed with free(3).
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern DoublyCell * doubly_extract_last_occurrence(DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function doubly_find_first_occurrence
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList to read #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return DoublyCell * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function search the first occurrence of target_data in list.
+ * 		The search starts from the head of list.
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern DoublyCell * doubly_find_first_occurrence(const DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function doubly_find_last_occurrence
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList to read #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return DoublyCell * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function search the last occurrence of target_data in list.
+ * 		The search starts from the tail of list and stops at the first match.
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern DoublyCell * doubly_find_last_occurrence(const DoublyLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function doubly_linked_list_size
+ * @Params
+ * 		DoublyLinkedList *list
+ * 		# DoublyLinkedList to read #
+ * @Return size_t # number of elements in list #
+ * @Description
+ * 		This function returns the number of elements in list, in O(1).
+ */
+extern size_t doubly_linked_list_size(const DoublyLinkedList *list);
+
+
+#endif /* HEADER_DOUBLY_LINKED_LIST_H_ */
@@ -0,0 +1,496 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "epoch_linked_list.h"
+
+
+/*
+ * This function frees a cell, and its data if free_data is not NULL.
+ */
+static void free_epoch_cell(EpochLinkedList *list, EpochCell *cell) {
+
+	if (list->type->free_data != NULL)
+		list->type->free_data(&(cell->data));
+	free(cell);
+
+}
+
+/*
+ * This function create an EpochCell allocated with malloc(3), not linked yet.
+ * It returns NULL if there were an allocation problem.
+ */
+static EpochCell * alloc_epoch_cell(void *data, EpochCell *next) {
+
+	EpochCell *cell = (EpochCell *)malloc(sizeof(EpochCell));
+
+	if (NULL == cell) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return NULL;
+	}
+
+	cell->data = data;
+	atomic_init(&(cell->next), next);
+	cell->retired = NULL;
+	cell->retire_epoch = 0;
+
+	return cell;
+
+}
+
+/*
+ * This function returns the link to the first cell of list equal to target_data,
+ * or the link at the end of list if there is none.
+ * The mutex of list must be taken.
+ */
+static _Atomic(EpochCell *) * search_link(EpochLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	_Atomic(EpochCell *) *link = &(list->head);
+	EpochCell *cell;
+
+	while ((cell = atomic_load_explicit(link, memory_order_relaxed)) != NULL) {
+		if (cmp_data(cell->data, target_data) == 0)
+			break;
+		link = &(cell->next);
+	}
+
+	return link;
+
+}
+
+/*
+ * This function publishes a new cell at the place of the link : readers see the list before or after, never between.
+ * The mutex of list must be taken.
+ */
+static int publish_at(EpochLinkedList *list, _Atomic(EpochCell *) *link, void *data) {
+
+	EpochCell *cell = alloc_epoch_cell(data, atomic_load_explicit(link, memory_order_relaxed));
+
+	if (NULL == cell)
+		return 0;
+
+	atomic_store_explicit(link, cell, memory_order_release);
+	atomic_fetch_add_explicit(&(list->size), 1, memory_order_relaxed);
+
+	return 1;
+
+}
+
+/*
+ * This function frees the retired cells unlinked before the epoch of the oldest reader.
+ * The mutex of list must be taken.
+ * It returns the number of retired cells not freed.
+ */
+static size_t reclaim_retired(EpochLinkedList *list) {
+
+	EpochReader *reader;
+	EpochCell **link = &(list->retired), *cell;
+	unsigned long oldest = ULONG_MAX, epoch;
+	size_t pending = 0;
+
+	/* the unlinks must be visible before the epochs of the readers are read */
+	atomic_thread_fence(memory_order_seq_cst);
+
+	for (reader = atomic_load_explicit(&(list->readers), memory_order_acquire); reader != NULL; reader = reader->next) {
+		epoch = atomic_load_explicit(&(reader->epoch), memory_order_seq_cst);
+		if (epoch != 0 && epoch < oldest)
+			oldest = epoch;
+	}
+
+	/* the retired cells are sorted from the last retired, so the freed ones are at the end */
+	while (*link != NULL && (*link)->retire_epoch >= oldest) {
+		pending += 1;
+		link = &((*link)->retired);
+	}
+
+	cell = *link;
+	*link = NULL;
+	while (cell != NULL) {
+		EpochCell *save = cell->retired;
+		free_epoch_cell(list, cell);
+		cell = save;
+	}
+
+	return pending;
+
+}
+
+/*
+ * This function moves the unlinked cells from first (chained by 'retired') to the retired cells of list,
+ * then ends the current epoch and frees what can be freed.
+ * The mutex of list must be taken.
+ */
+static void retire_cells(EpochLinkedList *list, EpochCell *first, EpochCell *last) {
+
+	EpochCell *cell;
+	unsigned long epoch = atomic_fetch_add_explicit(&(list->epoch), 1, memory_order_seq_cst);
+
+	for (cell = first; cell != NULL; cell = cell->retired)
+		cell->retire_epoch = epoch;
+
+	last->retired = list->retired;
+	list->retired = first;
+
+	reclaim_retired(list);
+
+}
+
+/*
+ * This function initializes list as an empty list of data of the given type.
+ * It returns 0 if the mutex cannot be created.
+ * Else it returns 1.
+ */
+int init_epoch_linked_list(EpochLinkedList *list, const ListType *type) {
+
+	list->type = type;
+	atomic_init(&(list->head), NULL);
+	atomic_init(&(list->size), 0);
+	atomic_init(&(list->epoch), 1);
+	atomic_init(&(list->readers), NULL);
+	list->retired = NULL;
+
+	return (pthread_mutex_init(&(list->writer), NULL) == 0);
+
+}
+
+/*
+ * This function frees all the cells of list, the retired ones included, and the slots of the readers.
+ */
+void free_epoch_linked_list(EpochLinkedList *list) {
+
+	EpochCell *cell, *save;
+	EpochReader *reader, *next;
+
+	cell = atomic_load_explicit(&(list->head), memory_order_relaxed);
+	while (cell != NULL) {
+		save = atomic_load_explicit(&(cell->next), memory_order_relaxed);
+		free_epoch_cell(list, cell);
+		cell = save;
+	}
+	atomic_store_explicit(&(list->head), NULL, memory_order_relaxed);
+
+	cell = list->retired;
+	while (cell != NULL) {
+		save = cell->retired;
+		free_epoch_cell(list, cell);
+		cell = save;
+	}
+	list->retired = NULL;
+
+	reader = atomic_load_explicit(&(list->readers), memory_order_relaxed);
+	while (reader != NULL) {
+		next = reader->next;
+		free(reader);
+		reader = next;
+	}
+	atomic_store_explicit(&(list->readers), NULL, memory_order_relaxed);
+
+	atomic_store_explicit(&(list->size), 0, memory_order_relaxed);
+	pthread_mutex_destroy(&(list->writer));
+
+}
+
+/*
+ * This function gives a slot to a reader thread.
+ * It returns NULL if there were an allocation problem.
+ */
+EpochReader * epoch_register_reader(EpochLinkedList *list) {
+
+	EpochReader *reader, *head;
+	int unused;
+
+	for (reader = atomic_load_explicit(&(list->readers), memory_order_acquire); reader != NULL; reader = reader->next) {
+		unused = 0;
+		if (atomic_compare_exchange_strong(&(reader->in_use), &unused, 1))
+			return reader;
+	}
+
+	reader = (EpochReader *)malloc(sizeof(EpochReader));
+	if (NULL == reader) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return NULL;
+	}
+	atomic_init(&(reader->epoch), 0);
+	atomic_init(&(reader->in_use), 1);
+	reader->list = list;
+
+	head = atomic_load_explicit(&(list->readers), memory_order_relaxed);
+	do {
+		reader->next = head;
+	} while (!atomic_compare_exchange_weak_explicit(&(list->readers), &head, reader, memory_order_release, memory_order_relaxed));
+
+	return reader;
+
+}
+
+/*
+ * This function gives back the slot of a reader.
+ */
+void epoch_unregister_reader(EpochReader *reader) {
+
+	atomic_store_explicit(&(reader->epoch), 0, memory_order_release);
+	atomic_store_explicit(&(reader->in_use), 0, memory_order_release);
+
+}
+
+/*
+ * This function starts a read of the list : until epoch_exit, no cell seen by the reader is freed.
+ */
+void epoch_enter(EpochReader *reader) {
+
+	atomic_store_explicit(&(reader->epoch), atomic_load(&(reader->list->epoch)), memory_order_seq_cst);
+	/* the epoch must be visible before the first cell is read */
+	atomic_thread_fence(memory_order_seq_cst);
+
+}
+
+/*
+ * This function ends a read of the list.
+ */
+void epoch_exit(EpochReader *reader) {
+
+	atomic_store_explicit(&(reader->epoch), 0, memory_order_release);
+
+}
+
+/*
+ * This function displays all the list on the console, followed by a new line.
+ * WARNING : the print_data function cannot be NULL.
+ */
+void print_epoch_linked_list(EpochReader *reader) {
+
+	EpochCell *cell = atomic_load_explicit(&(reader->list->head), memory_order_acquire);
+
+	while (cell != NULL) {
+		reader->list->type->print_data(cell->data);
+		cell = atomic_load_explicit(&(cell->next), memory_order_acquire);
+	}
+
+	printf("\n");
+
+}
+
+/*
+ * This function search the first occurrence of target_data in the list, without lock.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+EpochCell * epoch_find_first_occurrence(EpochReader *reader, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	EpochCell *cell = atomic_load_explicit(&(reader->list->head), memory_order_acquire);
+
+	if (NULL == cmp_data)
+		cmp_data = reader->list->type->cmp_data;
+
+	while (cell != NULL && cmp_data(cell->data, target_data) != 0)
+		cell = atomic_load_explicit(&(cell->next), memory_order_acquire);
+
+	return cell;
+
+}
+
+/*
+ * This function search the last occurrence of target_data in the list, without lock.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+EpochCell * epoch_find_last_occurrence(EpochReader *reader, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	EpochCell *cell = atomic_load_explicit(&(reader->list->head), memory_order_acquire), *found = NULL;
+
+	if (NULL == cmp_data)
+		cmp_data = reader->list->type->cmp_data;
+
+	while (cell != NULL) {
+		if (cmp_data(cell->data, target_data) == 0)
+			found = cell;
+		cell = atomic_load_explicit(&(cell->next), memory_order_acquire);
+	}
+
+	return found;
+
+}
+
+/*
+ * This function returns the number of elements in list, in O(1) and without lock.
+ */
+size_t epoch_linked_list_size(EpochLinkedList *list) {
+
+	return atomic_load_explicit(&(list->size), memory_order_relaxed);
+
+}
+
+/*
+ * This function add on the top of list the data in parameters.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int epoch_add_to_top(EpochLinkedList *list, void *data) {
+
+	int ret;
+
+	pthread_mutex_lock(&(list->writer));
+	ret = publish_at(list, &(list->head), data);
+	pthread_mutex_unlock(&(list->writer));
+
+	return ret;
+
+}
+
+/*
+ * This function add at the end of list the data in parameters.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int epoch_add_at_the_end(EpochLinkedList *list, void *data) {
+
+	_Atomic(EpochCell *) *link = &(list->head);
+	EpochCell *cell;
+	int ret;
+
+	pthread_mutex_lock(&(list->writer));
+	while ((cell = atomic_load_explicit(link, memory_order_relaxed)) != NULL)
+		link = &(cell->next);
+	ret = publish_at(list, link, data);
+	pthread_mutex_unlock(&(list->writer));
+
+	return ret;
+
+}
+
+/*
+ * This function add in list the data in parameters, after the first occurrence of reference_data.
+ * If reference_data is NULL, the data is added at the end of list.
+ * It returns 0 if there were an allocation problem or if reference_data has not been found.
+ * Else it returns 1.
+ */
+int epoch_add_after_first_occurrence(EpochLinkedList *list, void *data, void *reference_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	_Atomic(EpochCell *) *link;
+	EpochCell *reference;
+	int ret = 0;
+
+	if (NULL == reference_data)
+		return epoch_add_at_the_end(list, data);
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	pthread_mutex_lock(&(list->writer));
+	link = search_link(list, reference_data, cmp_data);
+	reference = atomic_load_explicit(link, memory_order_relaxed);
+	if (reference != NULL)
+		ret = publish_at(list, &(reference->next), data);
+	pthread_mutex_unlock(&(list->writer));
+
+	return ret;
+
+}
+
+/*
+ * This function add in list the data in parameters, before the first occurrence of reference_data.
+ * If reference_data is NULL, the data is added at the end of list.
+ * It returns 0 if there were an allocation problem or if reference_data has not been found.
+ * Else it returns 1.
+ */
+int epoch_add_before_first_occurrence(EpochLinkedList *list, void *data, void *reference_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	_Atomic(EpochCell *) *link;
+	int ret = 0;
+
+	if (NULL == reference_data)
+		return epoch_add_at_the_end(list, data);
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	pthread_mutex_lock(&(list->writer));
+	link = search_link(list, reference_data, cmp_data);
+	if (atomic_load_explicit(link, memory_order_relaxed) != NULL)
+		ret = publish_at(list, link, data);
+	pthread_mutex_unlock(&(list->writer));
+
+	return ret;
+
+}
+
+/*
+ * This function unlinks the first occurrence of target_data in list.
+ * The cell is freed, with its data, when no reader can see it anymore.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int epoch_remove_first_occurrence(EpochLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	_Atomic(EpochCell *) *link;
+	EpochCell *cell;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	pthread_mutex_lock(&(list->writer));
+	link = search_link(list, target_data, cmp_data);
+	cell = atomic_load_explicit(link, memory_order_relaxed);
+	if (cell != NULL) {
+		/* the cell keeps its next : a reader standing on it goes on in the list */
+		atomic_store_explicit(link, atomic_load_explicit(&(cell->next), memory_order_relaxed), memory_order_release);
+		atomic_fetch_sub_explicit(&(list->size), 1, memory_order_relaxed);
+		cell->retired = NULL;
+		retire_cells(list, cell, cell);
+	}
+	pthread_mutex_unlock(&(list->writer));
+
+	return (cell != NULL);
+
+}
+
+/*
+ * This function unlinks all the occurrences of target_data in list, in one pass.
+ * It returns the number of cells removed.
+ */
+size_t epoch_remove_all_occurrence(EpochLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	_Atomic(EpochCell *) *link = &(list->head);
+	EpochCell *cell, *first = NULL, *last = NULL;
+	size_t count = 0;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	pthread_mutex_lock(&(list->writer));
+	while ((cell = atomic_load_explicit(link, memory_order_relaxed)) != NULL) {
+		if (cmp_data(cell->data, target_data) == 0) {
+			atomic_store_explicit(link, atomic_load_explicit(&(cell->next), memory_order_relaxed), memory_order_release);
+			cell->retired = NULL;
+			if (NULL == first)
+				first = cell;
+			else
+				last->retired = cell;
+			last = cell;
+			count += 1;
+		} else {
+			link = &(cell->next);
+		}
+	}
+	if (count > 0) {
+		atomic_fetch_sub_explicit(&(list->size), count, memory_order_relaxed);
+		retire_cells(list, first, last);
+	}
+	pthread_mutex_unlock(&(list->writer));
+
+	return count;
+
+}
+
+/*
+ * This function frees the retired cells that no reader can see anymore.
+ * It returns the number of retired cells not freed yet.
+ */
+size_t epoch_reclaim(EpochLinkedList *list) {
+
+	size_t pending;
+
+	pthread_mutex_lock(&(list->writer));
+	pending = reclaim_retired(list);
+	pthread_mutex_unlock(&(list->writer));
+
+	return pending;
+
+}
@@ -0,0 +1,313 @@
+#ifndef HEADER_EPOCH_LINKED_LIST_H_
+#define HEADER_EPOCH_LINKED_LIST_H_
+
+#include <stddef.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "list_type.h"
+
+
+struct _epoch_cell {
+	void *data; /* data of the cell */
+	_Atomic(struct _epoch_cell *) next; /* pointer to the next cell */
+	struct _epoch_cell *retired; /* pointer to the next cell waiting to be freed */
+	unsigned long retire_epoch; /* epoch in which the cell has been unlinked */
+};
+/*
+ * Cell of an EpochLinkedList.
+ * An unlinked cell keeps its 'next' field, so a reader standing on it can continue its traversal.
+ */
+
+typedef struct _epoch_cell EpochCell;
+
+struct _epoch_reader {
+	_Atomic unsigned long epoch; /* epoch in which the reader entered, 0 outside of epoch_enter and epoch_exit */
+	atomic_int in_use; /* 1 if the slot is used by a thread */
+	struct _epoch_reader *next; /* pointer to the next slot of the list */
+	struct _epoch_linked_list *list; /* list read by the reader */
+};
+/*
+ * Slot of a reader thread, given by epoch_register_reader.
+ */
+
+typedef struct _epoch_reader EpochReader;
+
+struct _epoch_linked_list {
+	const ListType *type; /* functions shared by all the data of the list */
+	_Atomic(EpochCell *) head; /* pointer to the first cell of the list */
+	_Atomic size_t size; /* number of data in the list */
+	_Atomic unsigned long epoch; /* current epoch, incremented by each removal */
+	_Atomic(EpochReader *) readers; /* slots of the readers */
+	EpochCell *retired; /* cells unlinked but maybe still read, the last retired first */
+	pthread_mutex_t writer; /* lock taken by the functions which modify the list */
+};
+/*
+ * List read without lock by several threads, while other threads modify it.
+ * The writers are serialized by a mutex and publish each change with one atomic store,
+ * so a reader always sees a valid list.
+ * An unlinked cell is only freed, with its data, when no reader which may still see it remains :
+ * a reader announces the epoch in which it entered, and a cell unlinked in epoch e is freed
+ * once all the readers are outside or in an epoch after e.
+ */
+
+typedef struct _epoch_linked_list EpochLinkedList;
+
+
+/*
+ * @Function init_epoch_linked_list
+ * @Params
+ * 		EpochLinkedList *list
+ * 		# EpochLinkedList to initialize #
+ * 		const ListType *type
+ * 		# functions shared by all the data of the list #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function initializes list as an empty list of data of the given type.
+ * 		It returns 0 if the mutex cannot be created.
+ * 		Else it returns 1.
+ */
+extern int init_epoch_linked_list(EpochLinkedList *list, const ListType *type);
+
+/*
+ * @Function free_epoch_linked_list
+ * @Params
+ * 		EpochLinkedList *list
+ * 		# EpochLinkedList which will be modified #
+ * @Return void
+ * @Description
+ * 		This function frees all the cells of list, the retired ones included, with their data, and the slots of the readers.
+ * 		If the free_data of the ListType is NULL, the data are not freed.
+ * 		No other thread may use list during the call.
+ */
+extern void free_epoch_linked_list(EpochLinkedList *list);
+
+/*
+ * @Function epoch_register_reader
+ * @Params
+ * 		EpochLinkedList *list
+ * 		# EpochLinkedList which will be modified #
+ * @Return EpochReader * # slot of the reader or NULL #
+ * @Description
+ * 		This function gives a slot to a reader thread, reusing the slot of an unregistered reader if there is one.
+ * 		It returns NULL if there were an allocation problem.
+ */
+extern EpochReader * epoch_register_reader(EpochLinkedList *list);
+
+/*
+ * @Function epoch_unregister_reader
+ * @Params
+ * 		EpochReader *reader
+ * 		# slot given by epoch_register_reader #
+ * @Return void
+ * @Description
+ * 		This function gives back the slot of a reader, outside of epoch_enter and epoch_exit.
+ */
+extern void epoch_unregister_reader(EpochReader *reader);
+
+/*
+ * @Function epoch_enter
+ * @Params
+ * 		EpochReader *reader
+ * 		# slot given by epoch_register_reader #
+ * @Return void
+ * @Description
+ * 		This function starts a read of the list : until epoch_exit, no cell seen by the reader is freed.
+ * 		The calls cannot be nested.
+ */
+extern void epoch_enter(EpochReader *reader);
+
+/*
+ * @Function epoch_exit
+ * @Params
+ * 		EpochReader *reader
+ * 		# slot given by epoch_register_reader #
+ * @Return void
+ * @Description
+ * 		This function ends a read of the list : the cells returned since epoch_enter must not be used anymore.
+ */
+extern void epoch_exit(EpochReader *reader);
+
+/*
+ * @Function print_epoch_linked_list
+ * @Params
+ * 		EpochReader *reader
+ * 		# reader of the list, inside epoch_enter and epoch_exit #
+ * @Return void
+ * @Description
+ * 		This function displays all the list on the console, followed by a new line.
+ * 		WARNING : the print_data of the ListType cannot be NULL.
+ */
+extern void print_epoch_linked_list(EpochReader *reader);
+
+/*
+ * @Function epoch_find_first_occurrence
+ * @Params
+ * 		EpochReader *reader
+ * 		# reader of the list, inside epoch_enter and epoch_exit #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to the function which compares two data #
+ * 		# if NULL, the cmp_data of the ListType is used #
+ * @Return EpochCell * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function search the first occurrence of target_data in the list, without lock.
+ * 		The cell can be used until epoch_exit.
+ * 		If target_data is not present in the list, it returns NULL.
+ */
+extern EpochCell * epoch_find_first_occurrence(EpochReader *reader, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function epoch_find_last_occurrence
+ * @Params
+ * 		EpochReader *reader
+ * 		# reader of the list, inside epoch_enter and epoch_exit #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to the function which compares two data #
+ * 		# if NULL, the cmp_data of the ListType is used #
+ * @Return EpochCell * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function search the last occurrence of target_data in the list, without lock.
+ * 		The cell can be used until epoch_exit.
+ * 		If target_data is not present in the list, it returns NULL.
+ */
+extern EpochCell * epoch_find_last_occurrence(EpochReader *reader, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function epoch_linked_list_size
+ * @Params
+ * 		EpochLinkedList *list
+ * 		# EpochLinkedList to read #
+ * @Return size_t # number of elements in list #
+ * @Description
+ * 		This function returns the number of elements in list, in O(1) and without lock.
+ * 		It does not need epoch_enter.
+ */
+extern size_t epoch_linked_list_size(EpochLinkedList *list);
+
+/*
+ * @Function epoch_add_to_top
+ * @Params
+ * 		EpochLinkedList *list
+ * 		# EpochLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add on the top of list the data in parameters.
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int epoch_add_to_top(EpochLinkedList *list, void *data);
+
+/*
+ * @Function epoch_add_at_the_end
+ * @Params
+ * 		EpochLinkedList *list
+ * 		# EpochLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add at the end of list the data in parameters.
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int epoch_add_at_the_end(EpochLinkedList *list, void *data);
+
+/*
+ * @Function epoch_add_after_first_occurrence
+ * @Params
+ * 		EpochLinkedList *list
+ * 		# EpochLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference_data
+ * 		# data to search in list #
+ * 		# if NULL, data is added at the end of the list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to the function which compares two data #
+ * 		# if NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add in list the data in parameters, after the first occurrence of reference_data.
+ * 		If reference_data is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or if reference_data has not been found.
+ * 		Else it returns 1.
+ */
+extern int epoch_add_after_first_occurrence(EpochLinkedList *list, void *data, void *reference_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function epoch_add_before_first_occurrence
+ * @Params
+ * 		EpochLinkedList *list
+ * 		# EpochLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference_data
+ * 		# data to search in list #
+ * 		# if NULL, data is added at the end of the list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to the function which compares two data #
+ * 		# if NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add in list the data in parameters, before the first occurrence of reference_data.
+ * 		If reference_data is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or if reference_data has not been found.
+ * 		Else it returns 1.
+ */
+extern int epoch_add_before_first_occurrence(EpochLinkedList *list, void *data, void *reference_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function epoch_remove_first_occurrence
+ * @Params
+ * 		EpochLinkedList *list
+ * 		# EpochLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to the function which compares two data #
+ * 		# if NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function unlinks the first occurrence of target_data in list.
+ * 		The cell and its data (with the free_data of the ListType) are freed when no reader can see them anymore.
+ * 		If target_data has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int epoch_remove_first_occurrence(EpochLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function epoch_remove_all_occurrence
+ * @Params
+ * 		EpochLinkedList *list
+ * 		# EpochLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to the function which compares two data #
+ * 		# if NULL, the cmp_data of the ListType is used #
+ * @Return size_t # number of cells removed #
+ * @Description
+ * 		This function unlinks all the occurrences of target_data in list, in one pass.
+ * 		The cells and their data are freed when no reader can see them anymore.
+ */
+extern size_t epoch_remove_all_occurrence(EpochLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function epoch_reclaim
+ * @Params
+ * 		EpochLinkedList *list
+ * 		# EpochLinkedList which will be modified #
+ * @Return size_t # number of retired cells not freed yet #
+ * @Description
+ * 		This function frees the retired cells that no reader can see anymore.
+ * 		The functions which remove already call it, it is only needed to free the cells sooner.
+ */
+extern size_t epoch_reclaim(EpochLinkedList *list);
+
+
+#endif /* HEADER_EPOCH_LINKED_LIST_H_ */
@@ -0,0 +1,555 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "indexed_linked_list.h"
+
+
+#define INITIAL_BUCKET_COUNT 16
+
+
+struct _index_entry {
+	struct _index_entry *next; /* next entry of the same bucket */
+	unsigned long hash; /* hash of the data */
+	LinkedList *first; /* first cell of the data */
+	LinkedList *first_previous; /* cell before 'first', NULL if 'first' is the head */
+	LinkedList *last; /* last cell of the data */
+	LinkedList *last_previous; /* cell before 'last', NULL if 'last' is the head */
+	size_t count; /* number of cells of the data */
+};
+
+
+/*
+ * This function search the entry of data in the index.
+ * It returns the entry, or NULL if data is not in the list.
+ */
+static struct _index_entry * lookup_entry(const IndexedLinkedList *list, void *data, unsigned long hash) {
+
+	struct _index_entry *entry = list->buckets[hash & (list->bucket_count - 1)];
+
+	while (entry != NULL && (entry->hash != hash || list->cmp_data(data, entry->first->data) != 0))
+		entry = entry->next;
+
+	return entry;
+
+}
+
+/*
+ * This function doubles the number of buckets of the index.
+ * It returns 0 if there were an allocation problem (the index is then unchanged).
+ * Else it returns 1.
+ */
+static int grow_index(IndexedLinkedList *list) {
+
+	struct _index_entry **buckets, *entry, *save;
+	size_t i, bucket_count = list->bucket_count * 2;
+
+	buckets = (struct _index_entry **)calloc(bucket_count, sizeof(struct _index_entry *));
+	if (NULL == buckets)
+		return 0;
+
+	for (i = 0; i < list->bucket_count; i++) {
+		entry = list->buckets[i];
+		while (entry != NULL) {
+			save = entry->next;
+			entry->next = buckets[entry->hash & (bucket_count - 1)];
+			buckets[entry->hash & (bucket_count - 1)] = entry;
+			entry = save;
+		}
+	}
+
+	free(list->buckets);
+	list->buckets = buckets;
+	list->bucket_count = bucket_count;
+
+	return 1;
+
+}
+
+/*
+ * This function adds an entry for a cell whose data is not in the index yet.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+static int add_entry(IndexedLinkedList *list, LinkedList *cell, LinkedList *previous, unsigned long hash) {
+
+	struct _index_entry *entry;
+
+	if (list->entry_count >= list->bucket_count - list->bucket_count / 4)
+		grow_index(list);
+
+	entry = (struct _index_entry *)malloc(sizeof(struct _index_entry));
+	if (NULL == entry) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return 0;
+	}
+
+	entry->hash = hash;
+	entry->first = cell;
+	entry->first_previous = previous;
+	entry->last = cell;
+	entry->last_previous = previous;
+	entry->count = 1;
+	entry->next = list->buckets[hash & (list->bucket_count - 1)];
+	list->buckets[hash & (list->bucket_count - 1)] = entry;
+	list->entry_count += 1;
+
+	return 1;
+
+}
+
+/*
+ * This function removes an entry from the index and frees it.
+ */
+static void remove_entry(IndexedLinkedList *list, struct _index_entry *entry) {
+
+	struct _index_entry **link = &(list->buckets[entry->hash & (list->bucket_count - 1)]);
+
+	while (*link != entry)
+		link = &((*link)->next);
+	*link = entry->next;
+	list->entry_count -= 1;
+
+	free(entry);
+
+}
+
+/*
+ * This function tells the index that the cell before 'cell' is now 'previous'.
+ */
+static void set_previous(IndexedLinkedList *list, LinkedList *cell, LinkedList *previous) {
+
+	struct _index_entry *entry;
+
+	if (NULL == cell)
+		return;
+
+	entry = lookup_entry(list, cell->data, list->hash_data(cell->data));
+	if (entry->first == cell)
+		entry->first_previous = previous;
+	if (entry->last == cell)
+		entry->last_previous = previous;
+
+}
+
+/*
+ * This function inserts a new cell after previous (at the top if previous is NULL) and indexes it.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+static int insert_after(IndexedLinkedList *list, LinkedList *previous, void *data, void (*print_data)(void *data), void (*free_data)(void **data)) {
+
+	LinkedList **link = (NULL == previous) ? &(list->list.head) : &(previous->next);
+	LinkedList *cell, *tmp;
+	struct _index_entry *entry;
+	unsigned long hash = list->hash_data(data);
+
+	entry = lookup_entry(list, data, hash);
+
+	if (!add_to_top(link, data, print_data, free_data))
+		return 0;
+	cell = *link;
+
+	if (NULL == entry && !add_entry(list, cell, previous, hash)) {
+		*link = cell->next;
+		free_linked_list_cell(cell);
+		return 0;
+	}
+
+	if (previous == list->list.tail)
+		list->list.tail = cell;
+	list->list.size += 1;
+	set_previous(list, cell->next, cell);
+
+	if (NULL == entry)
+		return 1;
+
+	entry->count += 1;
+	if (NULL == previous || cell->next == entry->first) {
+		entry->first = cell;
+		entry->first_previous = previous;
+	} else if (previous == entry->last) {
+		entry->last = cell;
+		entry->last_previous = previous;
+	} else {
+		/* the next occurrence tells if the cell is before the first one or after the last one */
+		tmp = cell->next;
+		while (tmp != NULL && list->cmp_data(data, tmp->data) != 0)
+			tmp = tmp->next;
+		if (NULL == tmp) {
+			entry->last = cell;
+			entry->last_previous = previous;
+		} else if (tmp == entry->first) {
+			entry->first = cell;
+			entry->first_previous = previous;
+		}
+	}
+
+	return 1;
+
+}
+
+/*
+ * This function unlinks the cell after previous (the head if previous is NULL) and removes it from the index.
+ * It returns the unlinked cell, whose 'next' field is the NULL pointer.
+ */
+static LinkedList * unlink_after(IndexedLinkedList *list, LinkedList *previous, struct _index_entry *entry) {
+
+	LinkedList **link = (NULL == previous) ? &(list->list.head) : &(previous->next);
+	LinkedList *cell = *link, *next = cell->next, *before, *tmp;
+
+	*link = next;
+	if (cell == list->list.tail)
+		list->list.tail = previous;
+	list->list.size -= 1;
+	cell->next = NULL;
+
+	entry->count -= 1;
+	if (0 == entry->count) {
+		remove_entry(list, entry);
+	} else {
+		if (entry->first == cell) {
+			before = previous;
+			tmp = next;
+			while (list->cmp_data(cell->data, tmp->data) != 0) {
+				before = tmp;
+				tmp = tmp->next;
+			}
+			entry->first = tmp;
+			entry->first_previous = before;
+		}
+		if (entry->last == cell) {
+			before = entry->first_previous;
+			for (tmp = entry->first; tmp != next; tmp = tmp->next) {
+				if (list->cmp_data(cell->data, tmp->data) == 0) {
+					entry->last = tmp;
+					entry->last_previous = before;
+				}
+				before = tmp;
+			}
+		}
+	}
+
+	set_previous(list, next, previous);
+
+	return cell;
+
+}
+
+/*
+ * This function initializes list as an empty list with an empty index.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int init_indexed_linked_list(IndexedLinkedList *list, unsigned long (*hash_data)(void *data), int (*cmp_data)(void *data1, void *data2)) {
+
+	init_linked_list_header(&(list->list));
+	list->hash_data = hash_data;
+	list->cmp_data = cmp_data;
+	list->entry_count = 0;
+	list->bucket_count = INITIAL_BUCKET_COUNT;
+	list->buckets = (struct _index_entry **)calloc(INITIAL_BUCKET_COUNT, sizeof(struct _index_entry *));
+	if (NULL == list->buckets) {
+		fprintf(stderr, "error: allocation fail.\n");
+		list->bucket_count = 0;
+		return 0;
+	}
+
+	return 1;
+
+}
+
+/*
+ * This function frees all the entries of the index, and its buckets.
+ */
+static void free_index(IndexedLinkedList *list) {
+
+	struct _index_entry *entry, *save;
+	size_t i;
+
+	for (i = 0; i < list->bucket_count; i++) {
+		entry = list->buckets[i];
+		while (entry != NULL) {
+			save = entry->next;
+			free(entry);
+			entry = save;
+		}
+	}
+
+	free(list->buckets);
+	list->buckets = NULL;
+	list->bucket_count = 0;
+	list->entry_count = 0;
+
+}
+
+/*
+ * This function moves the cells of a LinkedList at the end of list, and indexes them in one pass.
+ * It returns 0 if there were an allocation problem, and cells points to the first cell not moved.
+ * Else it returns 1.
+ */
+int index_linked_list(IndexedLinkedList *list, LinkedList **cells) {
+
+	LinkedList *tmp;
+	struct _index_entry *entry;
+	unsigned long hash;
+
+	while ((tmp = *cells) != NULL) {
+		hash = list->hash_data(tmp->data);
+		entry = lookup_entry(list, tmp->data, hash);
+		if (NULL == entry) {
+			if (!add_entry(list, tmp, list->list.tail, hash))
+				return 0;
+		} else {
+			entry->count += 1;
+			entry->last = tmp;
+			entry->last_previous = list->list.tail;
+		}
+		*cells = tmp->next;
+		tmp->next = NULL;
+		if (NULL == list->list.head)
+			list->list.head = tmp;
+		else
+			list->list.tail->next = tmp;
+		list->list.tail = tmp;
+		list->list.size += 1;
+	}
+
+	return 1;
+
+}
+
+/*
+ * This function frees the index of list and returns its cells as a LinkedList.
+ * At the end of the function, list is an empty list without index.
+ */
+LinkedList * unindex_linked_list(IndexedLinkedList *list) {
+
+	LinkedList *cells = list->list.head;
+
+	free_index(list);
+	init_linked_list_header(&(list->list));
+
+	return cells;
+
+}
+
+/*
+ * This function frees the cells of list and its index.
+ * At the end of the function, list is an empty list without index.
+ */
+void free_indexed_linked_list(IndexedLinkedList *list) {
+
+	free_index(list);
+	free_linked_list_header(&(list->list));
+
+}
+
+/*
+ * This function add to the top of list the data in parameters.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int indexed_add_to_top(IndexedLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data)) {
+
+	return insert_after(list, NULL, data, print_data, free_data);
+
+}
+
+/*
+ * This function add at the end of list the data in parameters.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int indexed_add_at_the_end(IndexedLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data)) {
+
+	return insert_after(list, list->list.tail, data, print_data, free_data);
+
+}
+
+/*
+ * This function add after the first occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int indexed_add_after_first_occurrence(IndexedLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference) {
+
+	struct _index_entry *entry;
+
+	if (NULL == reference)
+		return indexed_add_at_the_end(list, data, print_data, free_data);
+
+	entry = lookup_entry(list, reference, list->hash_data(reference));
+	if (NULL == entry) {
+		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_after(list, entry->first, data, print_data, free_data);
+
+}
+
+/*
+ * This function add after the last occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int indexed_add_after_last_occurrence(IndexedLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference) {
+
+	struct _index_entry *entry;
+
+	if (NULL == reference)
+		return indexed_add_at_the_end(list, data, print_data, free_data);
+
+	entry = lookup_entry(list, reference, list->hash_data(reference));
+	if (NULL == entry) {
+		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_after(list, entry->last, data, print_data, free_data);
+
+}
+
+/*
+ * This function add before the first occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int indexed_add_before_first_occurrence(IndexedLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference) {
+
+	struct _index_entry *entry;
+
+	if (NULL == reference)
+		return indexed_add_at_the_end(list, data, print_data, free_data);
+
+	entry = lookup_entry(list, reference, list->hash_data(reference));
+	if (NULL == entry) {
+		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_after(list, entry->first_previous, data, print_data, free_data);
+
+}
+
+/*
+ * This function add before the last occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int indexed_add_before_last_occurrence(IndexedLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference) {
+
+	struct _index_entry *entry;
+
+	if (NULL == reference)
+		return indexed_add_at_the_end(list, data, print_data, free_data);
+
+	entry = lookup_entry(list, reference, list->hash_data(reference));
+	if (NULL == entry) {
+		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_after(list, entry->last_previous, data, print_data, free_data);
+
+}
+
+/*
+ * This function remove the first occurrence of target_data in list.
+ * The cell is freed but not its data.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int indexed_remove_first_occurrence(IndexedLinkedList *list, void *target_data) {
+
+	LinkedList *extracted = indexed_extract_first_occurrence(list, target_data);
+
+	if (NULL == extracted)
+		return 0;
+
+	free_linked_list_cell(extracted);
+
+	return 1;
+
+}
+
+/*
+ * This function remove the last occurrence of target_data in list.
+ * The cell is freed but not its data.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int indexed_remove_last_occurrence(IndexedLinkedList *list, void *target_data) {
+
+	LinkedList *extracted = indexed_extract_last_occurrence(list, target_data);
+
+	if (NULL == extracted)
+		return 0;
+
+	free_linked_list_cell(extracted);
+
+	return 1;
+
+}
+
+/*
+ * This function extract the first occurrence of target_data in list.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+LinkedList * indexed_extract_first_occurrence(IndexedLinkedList *list, void *target_data) {
+
+	struct _index_entry *entry = lookup_entry(list, target_data, list->hash_data(target_data));
+
+	if (NULL == entry)
+		return NULL;
+
+	return unlink_after(list, entry->first_previous, entry);
+
+}
+
+/*
+ * This function extract the last occurrence of target_data in list.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+LinkedList * indexed_extract_last_occurrence(IndexedLinkedList *list, void *target_data) {
+
+	struct _index_entry *entry = lookup_entry(list, target_data, list->hash_data(target_data));
+
+	if (NULL == entry)
+		return NULL;
+
+	return unlink_after(list, entry->last_previous, entry);
+
+}
+
+/*
+ * This function search the first occurrence of target_data in list, with the index.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+LinkedList * indexed_find_first_occurrence(const IndexedLinkedList *list, void *target_data) {
+
+	struct _index_entry *entry = lookup_entry(list, target_data, list->hash_data(target_data));
+
+	return (NULL == entry) ? NULL : entry->first;
+
+}
+
+/*
+ * This function search the last occurrence of target_data in list, with the index.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+LinkedList * indexed_find_last_occurrence(const IndexedLinkedList *list, void *target_data) {
+
+	struct _index_entry *entry = lookup_entry(list, target_data, list->hash_data(target_data));
+
+	return (NULL == entry) ? NULL : entry->last;
+
+}
+
+/*
+ * This function returns the number of elements in list, in O(1).
+ */
+size_t indexed_linked_list_size(const IndexedLinkedList *list) {
+
+	return list->list.size;
+
+}
@@ -0,0 +1,325 @@
+#ifndef HEADER_INDEXED_LINKED_LIST_H_
+#define HEADER_INDEXED_LINKED_LIST_H_
+
+#include <stddef.h>
+#include "linked_list.h"
+
+
+struct _index_entry;
+/*
+ * Entry of the hash index : first and last cells of a data, and the cells before them.
+ * The fields of this structure are private to indexed_linked_list.c.
+ */
+
+struct _indexed_linked_list {
+	LinkedListHeader list; /* cells of the list */
+	unsigned long (*hash_data)(void *data); /* pointer to the function which hashes the data */
+	int (*cmp_data)(void *data1, void *data2); /* pointer to the function which compares the data */
+	struct _index_entry **buckets; /* hash table of the entries */
+	size_t bucket_count; /* number of buckets, always a power of 2 */
+	size_t entry_count; /* number of distinct data in the list */
+};
+/*
+ * LinkedList with a hash index which maps each distinct data to its first and last cells.
+ * Finding an occurrence and adding after or before it are O(1) expected.
+ * Removing (or extracting) an occurrence is O(1) expected too, except when the data has other occurrences :
+ * then the new first (or last) occurrence is searched between the old ones.
+ * Adding a data which already has occurrences walks forward until the next occurrence, to keep its first and last cells.
+ * 'list.head' can be given to every function which reads a LinkedList.
+ * WARNING: the list must only be modified with the indexed_* functions,
+ * and hash_data must return the same value for two data that cmp_data finds equal.
+ */
+
+typedef struct _indexed_linked_list IndexedLinkedList;
+
+
+/*
+ * @Function init_indexed_linked_list
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList to initialize #
+ * 		unsigned long (*hash_data)(void *data)
+ * 		# pointer to the function which hashes the data #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to the function which compares the data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function initializes list as an empty list with an empty index.
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int init_indexed_linked_list(IndexedLinkedList *list, unsigned long (*hash_data)(void *data), int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function index_linked_list
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList which will be modified #
+ * 		LinkedList **cells
+ * 		# LinkedList to index #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function moves the cells of a LinkedList at the end of list, and indexes them in one pass.
+ * 		It returns 0 if there were an allocation problem : the cells moved before the problem stay at the end of list,
+ * 		indexed, and cells points to the first cell not moved, so the call can be retried to move the rest.
+ * 		Else it returns 1, and cells points to the NULL pointer.
+ */
+extern int index_linked_list(IndexedLinkedList *list, LinkedList **cells);
+
+/*
+ * @Function unindex_linked_list
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList which will be modified #
+ * @Return LinkedList * # cells of list #
+ * @Description
+ * 		This function frees the index of list and returns its cells as a LinkedList.
+ * 		At the end of the function, list is an empty list without index.
+ */
+extern LinkedList * unindex_linked_list(IndexedLinkedList *list);
+
+/*
+ * @Function free_indexed_linked_list
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList which will be modified #
+ * @Return void
+ * @Description
+ * 		This function frees the cells of list, like free_linked_list, and its index.
+ * 		At the end of the function, list is an empty list without index.
+ */
+extern void free_indexed_linked_list(IndexedLinkedList *list);
+
+/*
+ * @Function indexed_add_to_top
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add to the top of list the data in parameters.
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int indexed_add_to_top(IndexedLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data));
+
+/*
+ * @Function indexed_add_at_the_end
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add at the end of list the data in parameters.
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int indexed_add_at_the_end(IndexedLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data));
+
+/*
+ * @Function indexed_add_after_first_occurrence
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * 		void *reference
+ * 		# data reference to add data after it #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add after the first occurrence of reference in list, the data in parameters.
+ * 		The occurrence is found with the index, in O(1) expected.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int indexed_add_after_first_occurrence(IndexedLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference);
+
+/*
+ * @Function indexed_add_before_first_occurrence
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * 		void *reference
+ * 		# data reference to add data before it #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add before the first occurrence of reference in list, the data in parameters.
+ * 		The occurrence is found with the index, in O(1) expected.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int indexed_add_before_first_occurrence(IndexedLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference);
+
+/*
+ * @Function indexed_add_after_last_occurrence
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * 		void *reference
+ * 		# data reference to add data after it #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add after the last occurrence of reference in list, the data in parameters.
+ * 		The occurrence is found with the index, in O(1) expected.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int indexed_add_after_last_occurrence(IndexedLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference);
+
+/*
+ * @Function indexed_add_before_last_occurrence
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * 		void *reference
+ * 		# data reference to add data before it #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add before the last occurrence of reference in list, the data in parameters.
+ * 		The occurrence is found with the index, in O(1) expected.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int indexed_add_before_last_occurrence(IndexedLinkedList *list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference);
+
+/*
+ * @Function indexed_remove_first_occurrence
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function remove the first occurrence of target_data in list.
+ * 		Like remove_first_occurrence, the cell is freed but not its data.
+ * 		If target_data has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int indexed_remove_first_occurrence(IndexedLinkedList *list, void *target_data);
+
+/*
+ * @Function indexed_remove_last_occurrence
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function remove the last occurrence of target_data in list.
+ * 		Like remove_last_occurrence, the cell is freed but not its data.
+ * 		If target_data has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int indexed_remove_last_occurrence(IndexedLinkedList *list, void *target_data);
+
+/*
+ * @Function indexed_extract_first_occurrence
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * @Return LinkedList * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function remove the first occurrence of target_data in list, and returns its cell.
+ * 		The 'next' field of the returned cell is the NULL pointer.
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern LinkedList * indexed_extract_first_occurrence(IndexedLinkedList *list, void *target_data);
+
+/*
+ * @Function indexed_extract_last_occurrence
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * @Return LinkedList * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function remove the last occurrence of target_data in list, and returns its cell.
+ * 		The 'next' field of the returned cell is the NULL pointer.
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern LinkedList * indexed_extract_last_occurrence(IndexedLinkedList *list, void *target_data);
+
+/*
+ * @Function indexed_find_first_occurrence
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList to read #
+ * 		void *target_data
+ * 		# data to search in list #
+ * @Return LinkedList * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function search the first occurrence of target_data in list, with the index, in O(1) expected.
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern LinkedList * indexed_find_first_occurrence(const IndexedLinkedList *list, void *target_data);
+
+/*
+ * @Function indexed_find_last_occurrence
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList to read #
+ * 		void *target_data
+ * 		# data to search in list #
+ * @Return LinkedList * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function search the last occurrence of target_data in list, with the index, in O(1) expected.
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern LinkedList * indexed_find_last_occurrence(const IndexedLinkedList *list, void *target_data);
+
+/*
+ * @Function indexed_linked_list_size
+ * @Params
+ * 		IndexedLinkedList *list
+ * 		# IndexedLinkedList to read #
+ * @Return size_t # number of elements in list #
+ * @Description
+ * 		This function returns the number of elements in list, in O(1).
+ */
+extern size_t indexed_linked_list_size(const IndexedLinkedList *list);
+
+
+#endif /* HEADER_INDEXED_LINKED_LIST_H_ */
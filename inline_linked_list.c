@@ -0,0 +1,410 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "inline_linked_list.h"
+
+
+const InlineType inline_int_type = {INLINE_INT, sizeof(int), NULL, NULL, NULL};
+const InlineType inline_long_type = {INLINE_LONG, sizeof(long), NULL, NULL, NULL};
+const InlineType inline_double_type = {INLINE_DOUBLE, sizeof(double), NULL, NULL, NULL};
+const InlineType inline_pointer_type = {INLINE_POINTER, sizeof(void *), NULL, NULL, NULL};
+
+
+/*
+ * This function create an InlineCell allocated with malloc(3), with a copy of payload.
+ * It returns NULL if there were an allocation problem.
+ */
+static InlineCell * alloc_inline_cell(const InlineType *type, const void *payload, InlineCell *next) {
+
+	InlineCell *cell = NULL;
+
+	cell = (InlineCell *)malloc(sizeof(InlineCell));
+	if (NULL == cell) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return NULL;
+	}
+
+	memcpy(cell->payload.bytes, payload, type->size);
+	cell->next = next;
+
+	return cell;
+
+}
+
+/*
+ * This function frees a cell, after releasing what its payload owns.
+ */
+static void free_inline_cell(const InlineType *type, InlineCell *cell) {
+
+	if (type->free_payload != NULL)
+		type->free_payload(cell->payload.bytes);
+	free(cell);
+
+}
+
+/*
+ * This function inserts a new cell after previous in list.
+ * If previous is NULL, the cell is inserted at the top of list.
+ * It returns 0 if list has no type or if there were an allocation problem.
+ * Else it returns 1.
+ */
+static int insert_after(InlineLinkedList *list, InlineCell *previous, const void *payload) {
+
+	InlineCell **link = (NULL == previous) ? &(list->head) : &(previous->next);
+	InlineCell *cell;
+
+	if (NULL == list->type) {
+		fprintf(stderr, "error: the list has no type.\n");
+		return 0;
+	}
+
+	cell = alloc_inline_cell(list->type, payload, *link);
+	if (NULL == cell)
+		return 0;
+
+	*link = cell;
+	if (previous == list->tail)
+		list->tail = cell;
+	list->size += 1;
+
+	return 1;
+
+}
+
+/*
+ * This function unlinks the cell after previous in list.
+ * If previous is NULL, the first cell is unlinked.
+ * It returns the unlinked cell.
+ */
+static InlineCell * unlink_after(InlineLinkedList *list, InlineCell *previous) {
+
+	InlineCell **link = (NULL == previous) ? &(list->head) : &(previous->next);
+	InlineCell *cell = *link;
+
+	*link = cell->next;
+	if (cell == list->tail)
+		list->tail = previous;
+	list->size -= 1;
+
+	return cell;
+
+}
+
+/*
+ * This function compares two INLINE_BYTES payloads.
+ * It returns 0 if they are equal.
+ */
+static int cmp_bytes(const InlineType *type, const void *payload1, const void *payload2) {
+
+	if (type->cmp_payload != NULL)
+		return type->cmp_payload(payload1, payload2);
+
+	return memcmp(payload1, payload2, type->size);
+
+}
+
+/*
+ * This function tells if the payload of cell is equal to reference.
+ */
+static int payload_equal(const InlineType *type, const InlineCell *cell, const void *reference) {
+
+	switch (type->kind) {
+	case INLINE_INT:
+		return INLINE_CELL_PAYLOAD(cell, const int) == *(const int *)reference;
+	case INLINE_LONG:
+		return INLINE_CELL_PAYLOAD(cell, const long) == *(const long *)reference;
+	case INLINE_DOUBLE:
+		return INLINE_CELL_PAYLOAD(cell, const double) == *(const double *)reference;
+	case INLINE_POINTER:
+		return INLINE_CELL_PAYLOAD(cell, void * const) == *(void * const *)reference;
+	default:
+		return cmp_bytes(type, cell->payload.bytes, reference) == 0;
+	}
+
+}
+
+/*
+ * Loop of search_with_previous, for one way to compare the payload of 'tmp' with reference.
+ */
+#define SEARCH_LOOP(equal) \
+	while (tmp != NULL) { \
+		if (equal) { \
+			*previous = before; \
+			*found = tmp; \
+			if (!last) \
+				return 1; \
+		} \
+		before = tmp; \
+		tmp = tmp->next; \
+	}
+
+/*
+ * This function search the first (or the last if 'last' is not 0) cell of list whose payload is equal to reference.
+ * 'previous' receives the cell before it (NULL for the first cell), and 'found' receives the cell.
+ * The kind of the payloads is tested once, so the scalar payloads are compared in the loop without a call.
+ * It returns 0 if reference has not been found.
+ * Else it returns 1.
+ */
+static int search_with_previous(const InlineLinkedList *list, const void *reference, int last, InlineCell **previous, InlineCell **found) {
+
+	InlineCell *before = NULL, *tmp = list->head;
+
+	*previous = NULL;
+	*found = NULL;
+	/* a list without type has no cell */
+	if (NULL == tmp)
+		return 0;
+	switch (list->type->kind) {
+	case INLINE_INT:
+		SEARCH_LOOP(INLINE_CELL_PAYLOAD(tmp, const int) == *(const int *)reference)
+		break;
+	case INLINE_LONG:
+		SEARCH_LOOP(INLINE_CELL_PAYLOAD(tmp, const long) == *(const long *)reference)
+		break;
+	case INLINE_DOUBLE:
+		SEARCH_LOOP(INLINE_CELL_PAYLOAD(tmp, const double) == *(const double *)reference)
+		break;
+	case INLINE_POINTER:
+		SEARCH_LOOP(INLINE_CELL_PAYLOAD(tmp, void * const) == *(void * const *)reference)
+		break;
+	default:
+		SEARCH_LOOP(cmp_bytes(list->type, tmp->payload.bytes, reference) == 0)
+		break;
+	}
+
+	return (*found != NULL);
+
+}
+
+#undef SEARCH_LOOP
+
+/*
+ * This function initializes list as an empty list of payloads of the given type.
+ * It returns 0 if the payloads of type do not fit in a cell : list is then empty and has no type.
+ * Else it returns 1.
+ */
+int init_inline_linked_list(InlineLinkedList *list, const InlineType *type) {
+
+	list->type = NULL;
+	list->head = NULL;
+	list->tail = NULL;
+	list->size = 0;
+
+	if (type->size > INLINE_PAYLOAD_SIZE) {
+		fprintf(stderr, "error: payloads larger than %d bytes cannot be inline.\n", INLINE_PAYLOAD_SIZE);
+		return 0;
+	}
+
+	list->type = type;
+
+	return 1;
+
+}
+
+/*
+ * This function frees all the cells of list.
+ * At the end of the function, list is an empty list.
+ */
+void free_inline_linked_list(InlineLinkedList *list) {
+
+	InlineCell *tmp = list->head, *save;
+
+	while (tmp != NULL) {
+		save = tmp->next;
+		free_inline_cell(list->type, tmp);
+		tmp = save;
+	}
+
+	list->head = NULL;
+	list->tail = NULL;
+	list->size = 0;
+
+}
+
+/*
+ * This function displays a payload when the type has no print_payload.
+ */
+static void print_default(const InlineType *type, const InlineCell *cell) {
+
+	size_t i;
+
+	switch (type->kind) {
+	case INLINE_INT:
+		printf("%d ", INLINE_CELL_PAYLOAD(cell, const int));
+		break;
+	case INLINE_LONG:
+		printf("%ld ", INLINE_CELL_PAYLOAD(cell, const long));
+		break;
+	case INLINE_DOUBLE:
+		printf("%g ", INLINE_CELL_PAYLOAD(cell, const double));
+		break;
+	case INLINE_POINTER:
+		printf("%p ", INLINE_CELL_PAYLOAD(cell, void * const));
+		break;
+	default:
+		for (i = 0; i < type->size; i++)
+			printf("%02x", cell->payload.bytes[i]);
+		printf(" ");
+		break;
+	}
+
+}
+
+/*
+ * This function displays all the list on the console, followed by a new line.
+ */
+void print_inline_linked_list(const InlineLinkedList *list) {
+
+	InlineCell *tmp = list->head;
+
+	while (tmp != NULL) {
+		if (list->type->print_payload != NULL)
+			list->type->print_payload(tmp->payload.bytes);
+		else
+			print_default(list->type, tmp);
+		tmp = tmp->next;
+	}
+
+	printf("\n");
+
+}
+
+/*
+ * This function add to the top of list a copy of payload, in O(1).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int inline_add_to_top(InlineLinkedList *list, const void *payload) {
+
+	return insert_after(list, NULL, payload);
+
+}
+
+/*
+ * This function add at the end of list a copy of payload, in O(1).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int inline_add_at_the_end(InlineLinkedList *list, const void *payload) {
+
+	return insert_after(list, list->tail, payload);
+
+}
+
+/*
+ * This function add after the first occurrence of reference in list, a copy of payload.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int inline_add_after_first_occurrence(InlineLinkedList *list, const void *payload, const void *reference) {
+
+	InlineCell *previous, *found;
+
+	if (NULL == reference)
+		return inline_add_at_the_end(list, payload);
+
+	if (!search_with_previous(list, reference, 0, &previous, &found)) {
+		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_after(list, found, payload);
+
+}
+
+/*
+ * This function add before the first occurrence of reference in list, a copy of payload.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int inline_add_before_first_occurrence(InlineLinkedList *list, const void *payload, const void *reference) {
+
+	InlineCell *previous, *found;
+
+	if (NULL == reference)
+		return inline_add_at_the_end(list, payload);
+
+	if (!search_with_previous(list, reference, 0, &previous, &found)) {
+		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_after(list, previous, payload);
+
+}
+
+/*
+ * This function remove the first occurrence of target in list.
+ * If target has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int inline_remove_first_occurrence(InlineLinkedList *list, const void *target) {
+
+	InlineCell *previous, *found;
+
+	if (!search_with_previous(list, target, 0, &previous, &found))
+		return 0;
+
+	free_inline_cell(list->type, unlink_after(list, previous));
+
+	return 1;
+
+}
+
+/*
+ * This function remove all occurrences of target in list, in one pass.
+ * It returns the number of removed elements.
+ */
+size_t inline_remove_all_occurrence(InlineLinkedList *list, const void *target) {
+
+	InlineCell *previous = NULL, *tmp = list->head;
+	size_t count = 0;
+
+	while (tmp != NULL) {
+		if (payload_equal(list->type, tmp, target)) {
+			free_inline_cell(list->type, unlink_after(list, previous));
+			count += 1;
+		} else {
+			previous = tmp;
+		}
+		tmp = (NULL == previous) ? list->head : previous->next;
+	}
+
+	return count;
+
+}
+
+/*
+ * This function returns the first cell of list whose payload is equal to target, or NULL.
+ */
+InlineCell * inline_find_first_occurrence(const InlineLinkedList *list, const void *target) {
+
+	InlineCell *previous, *found;
+
+	search_with_previous(list, target, 0, &previous, &found);
+
+	return found;
+
+}
+
+/*
+ * This function returns the last cell of list whose payload is equal to target, or NULL.
+ */
+InlineCell * inline_find_last_occurrence(const InlineLinkedList *list, const void *target) {
+
+	InlineCell *previous, *found;
+
+	search_with_previous(list, target, 1, &previous, &found);
+
+	return found;
+
+}
+
+/*
+ * This function returns the number of elements in list, in O(1).
+ */
+size_t inline_linked_list_size(const InlineLinkedList *list) {
+
+	return list->size;
+
+}
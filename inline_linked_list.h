@@ -0,0 +1,255 @@
+#ifndef HEADER_INLINE_LINKED_LIST_H_
+#define HEADER_INLINE_LINKED_LIST_H_
+
+#include <stddef.h>
+
+
+#define INLINE_PAYLOAD_SIZE 16
+/*
+ * Maximum number of bytes of a payload stored in a cell.
+ */
+
+enum inline_kind {
+	INLINE_BYTES, /* payload compared with cmp_payload, or byte by byte */
+	INLINE_INT, /* payload is an int */
+	INLINE_LONG, /* payload is a long */
+	INLINE_DOUBLE, /* payload is a double */
+	INLINE_POINTER /* payload is a void * */
+};
+/*
+ * Kind of the payloads of an InlineLinkedList.
+ * The searches on the scalar kinds compare the payloads directly, without calling a function.
+ */
+
+struct _inline_type {
+	enum inline_kind kind; /* kind of the payloads */
+	size_t size; /* number of bytes of a payload, at most INLINE_PAYLOAD_SIZE */
+	void (*print_payload)(const void *payload); /* pointer to the function which displays a payload, or NULL */
+	void (*free_payload)(void *payload); /* pointer to the function which releases what a payload owns, or NULL */
+	int (*cmp_payload)(const void *payload1, const void *payload2); /* pointer to the function which compares two INLINE_BYTES payloads, or NULL */
+};
+/*
+ * Type descriptor of the payloads of an InlineLinkedList.
+ * If print_payload is NULL, the scalar kinds are printed with printf(3) and INLINE_BYTES in hexadecimal.
+ * If cmp_payload is NULL, two INLINE_BYTES payloads are equal when their bytes are equal.
+ * An InlineType must live as long as the lists which use it.
+ */
+
+typedef struct _inline_type InlineType;
+
+extern const InlineType inline_int_type; /* int payloads */
+extern const InlineType inline_long_type; /* long payloads */
+extern const InlineType inline_double_type; /* double payloads */
+extern const InlineType inline_pointer_type; /* void * payloads, which are not freed */
+
+struct _inline_cell {
+	struct _inline_cell *next; /* pointer to the next cell of the structure */
+	union {
+		unsigned char bytes[INLINE_PAYLOAD_SIZE]; /* payload of the cell */
+		long long align_integer;
+		double align_double;
+		void *align_pointer;
+	} payload;
+};
+/*
+ * Cell of an InlineLinkedList : the payload is copied in the cell,
+ * so an element is one allocation and a search reads one cache line per element.
+ */
+
+typedef struct _inline_cell InlineCell;
+
+#define INLINE_CELL_PAYLOAD(cell, type) (*(type *)((cell)->payload.bytes))
+/*
+ * Payload of the InlineCell 'cell', read as a 'type'.
+ */
+
+struct _inline_linked_list {
+	const InlineType *type; /* type of the payloads of the list */
+	InlineCell *head; /* first cell of the list */
+	InlineCell *tail; /* last cell of the list */
+	size_t size; /* number of cells in the list */
+};
+/*
+ * Linked list of small payloads, stored inside the cells instead of behind a 'data' pointer.
+ */
+
+typedef struct _inline_linked_list InlineLinkedList;
+
+
+/*
+ * @Function init_inline_linked_list
+ * @Params
+ * 		InlineLinkedList *list
+ * 		# InlineLinkedList to initialize #
+ * 		const InlineType *type
+ * 		# type of the payloads of the list #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function initializes list as an empty list of payloads of the given type.
+ * 		It returns 0 if the payloads of type are larger than INLINE_PAYLOAD_SIZE bytes :
+ * 		list is then an empty list without type, to which the add functions refuse to add (they return 0).
+ * 		Else it returns 1.
+ */
+extern int init_inline_linked_list(InlineLinkedList *list, const InlineType *type);
+
+/*
+ * @Function free_inline_linked_list
+ * @Params
+ * 		InlineLinkedList *list
+ * 		# InlineLinkedList to free #
+ * @Return void
+ * @Description
+ * 		This function frees all the cells of list, after calling free_payload on their payload if it is not NULL.
+ * 		At the end of the function, list is an empty list.
+ */
+extern void free_inline_linked_list(InlineLinkedList *list);
+
+/*
+ * @Function print_inline_linked_list
+ * @Params
+ * 		const InlineLinkedList *list
+ * 		# InlineLinkedList to print #
+ * @Return void
+ * @Description
+ * 		This function displays all the list on the console, followed by a new line.
+ */
+extern void print_inline_linked_list(const InlineLinkedList *list);
+
+/*
+ * @Function inline_add_to_top
+ * @Params
+ * 		InlineLinkedList *list
+ * 		# InlineLinkedList which will be modified #
+ * 		const void *payload
+ * 		# payload to copy in the new cell #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function adds to the top of list a copy of the payload, in O(1).
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int inline_add_to_top(InlineLinkedList *list, const void *payload);
+
+/*
+ * @Function inline_add_at_the_end
+ * @Params
+ * 		InlineLinkedList *list
+ * 		# InlineLinkedList which will be modified #
+ * 		const void *payload
+ * 		# payload to copy in the new cell #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function adds at the end of list a copy of the payload, in O(1).
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int inline_add_at_the_end(InlineLinkedList *list, const void *payload);
+
+/*
+ * @Function inline_add_after_first_occurrence
+ * @Params
+ * 		InlineLinkedList *list
+ * 		# InlineLinkedList which will be modified #
+ * 		const void *payload
+ * 		# payload to copy in the new cell #
+ * 		const void *reference
+ * 		# payload after which the new cell is added #
+ * 		# if it is NULL, the cell is added at the end #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function adds a copy of the payload after the first occurrence of reference in list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int inline_add_after_first_occurrence(InlineLinkedList *list, const void *payload, const void *reference);
+
+/*
+ * @Function inline_add_before_first_occurrence
+ * @Params
+ * 		InlineLinkedList *list
+ * 		# InlineLinkedList which will be modified #
+ * 		const void *payload
+ * 		# payload to copy in the new cell #
+ * 		const void *reference
+ * 		# payload before which the new cell is added #
+ * 		# if it is NULL, the cell is added at the end #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function adds a copy of the payload before the first occurrence of reference in list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int inline_add_before_first_occurrence(InlineLinkedList *list, const void *payload, const void *reference);
+
+/*
+ * @Function inline_remove_first_occurrence
+ * @Params
+ * 		InlineLinkedList *list
+ * 		# InlineLinkedList which will be modified #
+ * 		const void *target
+ * 		# payload to remove #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function removes the first occurrence of target in list.
+ * 		free_payload is called on the payload of the cell if it is not NULL.
+ * 		If target has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int inline_remove_first_occurrence(InlineLinkedList *list, const void *target);
+
+/*
+ * @Function inline_remove_all_occurrence
+ * @Params
+ * 		InlineLinkedList *list
+ * 		# InlineLinkedList which will be modified #
+ * 		const void *target
+ * 		# payload to remove #
+ * @Return size_t # number of removed elements #
+ * @Description
+ * 		This function removes all the occurrences of target in list, in one pass.
+ * 		free_payload is called on the payloads of the cells if it is not NULL.
+ * 		It returns the number of removed elements.
+ */
+extern size_t inline_remove_all_occurrence(InlineLinkedList *list, const void *target);
+
+/*
+ * @Function inline_find_first_occurrence
+ * @Params
+ * 		const InlineLinkedList *list
+ * 		# InlineLinkedList where target is searched #
+ * 		const void *target
+ * 		# payload to find #
+ * @Return InlineCell * # cell where target is, or NULL #
+ * @Description
+ * 		This function searches the first occurrence of target in list.
+ * 		It returns the cell where the function found target, or NULL.
+ */
+extern InlineCell * inline_find_first_occurrence(const InlineLinkedList *list, const void *target);
+
+/*
+ * @Function inline_find_last_occurrence
+ * @Params
+ * 		const InlineLinkedList *list
+ * 		# InlineLinkedList where target is searched #
+ * 		const void *target
+ * 		# payload to find #
+ * @Return InlineCell * # cell where target is, or NULL #
+ * @Description
+ * 		This function searches the last occurrence of target in list.
+ * 		It returns the cell where the function found target, or NULL.
+ */
+extern InlineCell * inline_find_last_occurrence(const InlineLinkedList *list, const void *target);
+
+/*
+ * @Function inline_linked_list_size
+ * @Params
+ * 		const InlineLinkedList *list
+ * 		# InlineLinkedList to measure #
+ * @Return size_t # number of elements in list #
+ * @Description
+ * 		This function returns the number of elements in list, in O(1).
+ */
+extern size_t inline_linked_list_size(const InlineLinkedList *list);
+
+
+#endif /* HEADER_INLINE_LINKED_LIST_H_ */
@@ -0,0 +1,386 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "intrusive_list.h"
+
+
+/*
+ * This function links link after previous in list.
+ * If previous is NULL, link becomes the first link of list.
+ */
+static void insert_after(IntrusiveList *list, IntrusiveLink *previous, IntrusiveLink *link) {
+
+	IntrusiveLink **place = (NULL == previous) ? &(list->head) : &(previous->next);
+
+	link->next = *place;
+	*place = link;
+	if (previous == list->tail)
+		list->tail = link;
+	list->size += 1;
+
+}
+
+/*
+ * This function unlinks the link after previous in list.
+ * If previous is NULL, the first link is unlinked.
+ * It returns the unlinked link, whose 'next' field is the NULL pointer.
+ */
+static IntrusiveLink * unlink_after(IntrusiveList *list, IntrusiveLink *previous) {
+
+	IntrusiveLink **place = (NULL == previous) ? &(list->head) : &(previous->next);
+	IntrusiveLink *link = *place;
+
+	*place = link->next;
+	if (link == list->tail)
+		list->tail = previous;
+	list->size -= 1;
+	link->next = NULL;
+
+	return link;
+
+}
+
+/*
+ * This function search the first link of list for which cmp_link(link, target) is 0.
+ * 'previous' receives the link before it (NULL for the first link).
+ * It returns 0 if target has not been found.
+ * Else it returns 1.
+ */
+static int search_first_with_previous(IntrusiveLink *link, void *target, int (*cmp_link)(IntrusiveLink *link, void *target), IntrusiveLink **previous) {
+
+	IntrusiveLink *before = NULL;
+
+	while (link != NULL && cmp_link(link, target) != 0) {
+		before = link;
+		link = link->next;
+	}
+
+	*previous = before;
+
+	return (link != NULL);
+
+}
+
+/*
+ * This function search the last link of list for which cmp_link(link, target) is 0.
+ * 'previous' receives the link before it (NULL for the first link).
+ * It returns 0 if target has not been found.
+ * Else it returns 1.
+ */
+static int search_last_with_previous(IntrusiveLink *link, void *target, int (*cmp_link)(IntrusiveLink *link, void *target), IntrusiveLink **previous) {
+
+	IntrusiveLink *before = NULL;
+	int found = 0;
+
+	*previous = NULL;
+	while (link != NULL) {
+		if (cmp_link(link, target) == 0) {
+			*previous = before;
+			found = 1;
+		}
+		before = link;
+		link = link->next;
+	}
+
+	return found;
+
+}
+
+/*
+ * This function initializes list as an empty list.
+ */
+void init_intrusive_list(IntrusiveList *list) {
+
+	list->head = NULL;
+	list->tail = NULL;
+	list->size = 0;
+
+}
+
+/*
+ * This function unlinks all the structures of list, and calls free_link on each of them.
+ */
+void free_intrusive_list(IntrusiveList *list, void (*free_link)(IntrusiveLink *link)) {
+
+	IntrusiveLink *link = list->head, *save;
+
+	while (link != NULL) {
+		save = link->next;
+		link->next = NULL;
+		if (free_link != NULL)
+			free_link(link);
+		link = save;
+	}
+
+	init_intrusive_list(list);
+
+}
+
+/*
+ * This function displays all the list on the console, followed by a new line.
+ */
+void print_intrusive_list(IntrusiveList *list, void (*print_link)(IntrusiveLink *link)) {
+
+	IntrusiveLink *link;
+
+	for (link = list->head; link != NULL; link = link->next)
+		print_link(link);
+
+	printf("\n");
+
+}
+
+/*
+ * This function add on the top of list the structure of link, in O(1).
+ */
+void intrusive_add_to_top(IntrusiveList *list, IntrusiveLink *link) {
+
+	insert_after(list, NULL, link);
+
+}
+
+/*
+ * This function add at the end of list the structure of link, in O(1).
+ */
+void intrusive_add_at_the_end(IntrusiveList *list, IntrusiveLink *link) {
+
+	insert_after(list, list->tail, link);
+
+}
+
+/*
+ * This function add in list the structure of link, after the first occurrence of reference.
+ * If reference is NULL, the structure is added at the end of the list.
+ * It returns 0 if reference has not been found.
+ * Else it returns 1.
+ */
+int intrusive_add_after_first_occurrence(IntrusiveList *list, IntrusiveLink *link, void *reference, int (*cmp_link)(IntrusiveLink *link, void *target)) {
+
+	IntrusiveLink *previous;
+
+	if (NULL == reference) {
+		intrusive_add_at_the_end(list, link);
+		return 1;
+	}
+
+	if (!search_first_with_previous(list->head, reference, cmp_link, &previous)) {
+		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+		return 0;
+	}
+
+	insert_after(list, (NULL == previous) ? list->head : previous->next, link);
+
+	return 1;
+
+}
+
+/*
+ * This function add in list the structure of link, after the last occurrence of reference.
+ * If reference is NULL, the structure is added at the end of the list.
+ * It returns 0 if reference has not been found.
+ * Else it returns 1.
+ */
+int intrusive_add_after_last_occurrence(IntrusiveList *list, IntrusiveLink *link, void *reference, int (*cmp_link)(IntrusiveLink *link, void *target)) {
+
+	IntrusiveLink *previous;
+
+	if (NULL == reference) {
+		intrusive_add_at_the_end(list, link);
+		return 1;
+	}
+
+	if (!search_last_with_previous(list->head, reference, cmp_link, &previous)) {
+		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+		return 0;
+	}
+
+	insert_after(list, (NULL == previous) ? list->head : previous->next, link);
+
+	return 1;
+
+}
+
+/*
+ * This function add in list the structure of link, before the first occurrence of reference.
+ * If reference is NULL, the structure is added at the end of the list.
+ * It returns 0 if reference has not been found.
+ * Else it returns 1.
+ */
+int intrusive_add_before_first_occurrence(IntrusiveList *list, IntrusiveLink *link, void *reference, int (*cmp_link)(IntrusiveLink *link, void *target)) {
+
+	IntrusiveLink *previous;
+
+	if (NULL == reference) {
+		intrusive_add_at_the_end(list, link);
+		return 1;
+	}
+
+	if (!search_first_with_previous(list->head, reference, cmp_link, &previous)) {
+		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
+		return 0;
+	}
+
+	insert_after(list, previous, link);
+
+	return 1;
+
+}
+
+/*
+ * This function add in list the structure of link, before the last occurrence of reference.
+ * If reference is NULL, the structure is added at the end of the list.
+ * It returns 0 if reference has not been found.
+ * Else it returns 1.
+ */
+int intrusive_add_before_last_occurrence(IntrusiveList *list, IntrusiveLink *link, void *reference, int (*cmp_link)(IntrusiveLink *link, void *target)) {
+
+	IntrusiveLink *previous;
+
+	if (NULL == reference) {
+		intrusive_add_at_the_end(list, link);
+		return 1;
+	}
+
+	if (!search_last_with_previous(list->head, reference, cmp_link, &previous)) {
+		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
+		return 0;
+	}
+
+	insert_after(list, previous, link);
+
+	return 1;
+
+}
+
+/*
+ * This function unlinks the first occurrence of target from list, and calls free_link on it.
+ * If target has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int intrusive_remove_first_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target), void (*free_link)(IntrusiveLink *link)) {
+
+	IntrusiveLink *link = intrusive_extract_first_occurrence(list, target, cmp_link);
+
+	if (NULL == link)
+		return 0;
+
+	if (free_link != NULL)
+		free_link(link);
+
+	return 1;
+
+}
+
+/*
+ * This function unlinks the last occurrence of target from list, and calls free_link on it.
+ * If target has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int intrusive_remove_last_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target), void (*free_link)(IntrusiveLink *link)) {
+
+	IntrusiveLink *link = intrusive_extract_last_occurrence(list, target, cmp_link);
+
+	if (NULL == link)
+		return 0;
+
+	if (free_link != NULL)
+		free_link(link);
+
+	return 1;
+
+}
+
+/*
+ * This function unlinks all the occurrences of target from list, in one pass, and calls free_link on each of them.
+ * It returns the number of links removed.
+ */
+size_t intrusive_remove_all_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target), void (*free_link)(IntrusiveLink *link)) {
+
+	IntrusiveLink *previous = NULL, *link = list->head, *save;
+	size_t count = 0;
+
+	while (link != NULL) {
+		save = link->next;
+		if (cmp_link(link, target) == 0) {
+			unlink_after(list, previous);
+			if (free_link != NULL)
+				free_link(link);
+			count += 1;
+		} else {
+			previous = link;
+		}
+		link = save;
+	}
+
+	return count;
+
+}
+
+/*
+ * This function unlinks the first occurrence of target from list, and returns its link.
+ * If target is not present in list, it returns NULL.
+ */
+IntrusiveLink * intrusive_extract_first_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target)) {
+
+	IntrusiveLink *previous;
+
+	if (!search_first_with_previous(list->head, target, cmp_link, &previous))
+		return NULL;
+
+	return unlink_after(list, previous);
+
+}
+
+/*
+ * This function unlinks the last occurrence of target from list, and returns its link.
+ * If target is not present in list, it returns NULL.
+ */
+IntrusiveLink * intrusive_extract_last_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target)) {
+
+	IntrusiveLink *previous;
+
+	if (!search_last_with_previous(list->head, target, cmp_link, &previous))
+		return NULL;
+
+	return unlink_after(list, previous);
+
+}
+
+/*
+ * This function search the first occurrence of target in list.
+ * It returns the link where the function found target, or NULL.
+ */
+IntrusiveLink * intrusive_find_first_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target)) {
+
+	IntrusiveLink *link = list->head;
+
+	while (link != NULL && cmp_link(link, target) != 0)
+		link = link->next;
+
+	return link;
+
+}
+
+/*
+ * This function search the last occurrence of target in list.
+ * It returns the link where the function found target, or NULL.
+ */
+IntrusiveLink * intrusive_find_last_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target)) {
+
+	IntrusiveLink *link, *found = NULL;
+
+	for (link = list->head; link != NULL; link = link->next)
+		if (cmp_link(link, target) == 0)
+			found = link;
+
+	return found;
+
+}
+
+/*
+ * This function returns the number of structures in list, in O(1).
+ */
+size_t intrusive_list_size(IntrusiveList *list) {
+
+	return list->size;
+
+}
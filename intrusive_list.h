@@ -0,0 +1,321 @@
+#ifndef HEADER_INTRUSIVE_LIST_H_
+#define HEADER_INTRUSIVE_LIST_H_
+
+#include <stddef.h>
+
+
+struct _intrusive_link {
+	struct _intrusive_link *next; /* pointer to the link of the next structure */
+};
+/*
+ * Link to put in a structure so the structure can be in an IntrusiveList.
+ * A structure can be in as many IntrusiveList as it has links.
+ */
+
+typedef struct _intrusive_link IntrusiveLink;
+
+#define INTRUSIVE_CONTAINER_OF(link, type, member) ((type *)((char *)(link) - offsetof(type, member)))
+/*
+ * Pointer to the structure of type 'type' whose field 'member' is the IntrusiveLink 'link'.
+ */
+
+struct _intrusive_list {
+	IntrusiveLink *head; /* pointer to the first link of the list */
+	IntrusiveLink *tail; /* pointer to the last link of the list */
+	size_t size; /* number of links in the list */
+};
+/*
+ * List of structures which contain their own link : adding a structure allocates nothing,
+ * and the traversal reaches the structures without going through a 'data' pointer.
+ * The list never allocates nor frees the structures : removing a structure only unlinks it.
+ */
+
+typedef struct _intrusive_list IntrusiveList;
+
+
+/*
+ * @Function init_intrusive_list
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList to initialize #
+ * @Return void
+ * @Description
+ * 		This function initializes list as an empty list.
+ */
+extern void init_intrusive_list(IntrusiveList *list);
+
+/*
+ * @Function free_intrusive_list
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList which will be modified #
+ * 		void (*free_link)(IntrusiveLink *link)
+ * 		# pointer to the function which frees the structure of a link #
+ * 		# if NULL, the structures are only unlinked #
+ * @Return void
+ * @Description
+ * 		This function unlinks all the structures of list, and calls free_link on each of them.
+ * 		At the end of the function, list is an empty list.
+ */
+extern void free_intrusive_list(IntrusiveList *list, void (*free_link)(IntrusiveLink *link));
+
+/*
+ * @Function print_intrusive_list
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList to read #
+ * 		void (*print_link)(IntrusiveLink *link)
+ * 		# pointer to the function which displays the structure of a link #
+ * @Return void
+ * @Description
+ * 		This function displays all the list on the console, followed by a new line.
+ */
+extern void print_intrusive_list(IntrusiveList *list, void (*print_link)(IntrusiveLink *link));
+
+/*
+ * @Function intrusive_add_to_top
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList which will be modified #
+ * 		IntrusiveLink *link
+ * 		# link embedded in the structure to add #
+ * 		# it must not be in a list #
+ * @Return void
+ * @Description
+ * 		This function add on the top of list the structure of link, in O(1) and without allocation.
+ */
+extern void intrusive_add_to_top(IntrusiveList *list, IntrusiveLink *link);
+
+/*
+ * @Function intrusive_add_at_the_end
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList which will be modified #
+ * 		IntrusiveLink *link
+ * 		# link embedded in the structure to add #
+ * 		# it must not be in a list #
+ * @Return void
+ * @Description
+ * 		This function add at the end of list the structure of link, in O(1) and without allocation.
+ */
+extern void intrusive_add_at_the_end(IntrusiveList *list, IntrusiveLink *link);
+
+/*
+ * @Function intrusive_add_after_first_occurrence
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList which will be modified #
+ * 		IntrusiveLink *link
+ * 		# link embedded in the structure to add #
+ * 		# it must not be in a list #
+ * 		void *reference
+ * 		# data to search in list #
+ * 		# if NULL, link is added at the end of the list #
+ * 		int (*cmp_link)(IntrusiveLink *link, void *target)
+ * 		# pointer to the function which compares the structure of a link with target #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add in list the structure of link, after the first occurrence of reference.
+ * 		It returns 0 if reference has not been found.
+ * 		Else it returns 1.
+ */
+extern int intrusive_add_after_first_occurrence(IntrusiveList *list, IntrusiveLink *link, void *reference, int (*cmp_link)(IntrusiveLink *link, void *target));
+
+/*
+ * @Function intrusive_add_after_last_occurrence
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList which will be modified #
+ * 		IntrusiveLink *link
+ * 		# link embedded in the structure to add #
+ * 		# it must not be in a list #
+ * 		void *reference
+ * 		# data to search in list #
+ * 		# if NULL, link is added at the end of the list #
+ * 		int (*cmp_link)(IntrusiveLink *link, void *target)
+ * 		# pointer to the function which compares the structure of a link with target #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add in list the structure of link, after the last occurrence of reference.
+ * 		It returns 0 if reference has not been found.
+ * 		Else it returns 1.
+ */
+extern int intrusive_add_after_last_occurrence(IntrusiveList *list, IntrusiveLink *link, void *reference, int (*cmp_link)(IntrusiveLink *link, void *target));
+
+/*
+ * @Function intrusive_add_before_first_occurrence
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList which will be modified #
+ * 		IntrusiveLink *link
+ * 		# link embedded in the structure to add #
+ * 		# it must not be in a list #
+ * 		void *reference
+ * 		# data to search in list #
+ * 		# if NULL, link is added at the end of the list #
+ * 		int (*cmp_link)(IntrusiveLink *link, void *target)
+ * 		# pointer to the function which compares the structure of a link with target #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add in list the structure of link, before the first occurrence of reference.
+ * 		It returns 0 if reference has not been found.
+ * 		Else it returns 1.
+ */
+extern int intrusive_add_before_first_occurrence(IntrusiveList *list, IntrusiveLink *link, void *reference, int (*cmp_link)(IntrusiveLink *link, void *target));
+
+/*
+ * @Function intrusive_add_before_last_occurrence
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList which will be modified #
+ * 		IntrusiveLink *link
+ * 		# link embedded in the structure to add #
+ * 		# it must not be in a list #
+ * 		void *reference
+ * 		# data to search in list #
+ * 		# if NULL, link is added at the end of the list #
+ * 		int (*cmp_link)(IntrusiveLink *link, void *target)
+ * 		# pointer to the function which compares the structure of a link with target #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add in list the structure of link, before the last occurrence of reference.
+ * 		It returns 0 if reference has not been found.
+ * 		Else it returns 1.
+ */
+extern int intrusive_add_before_last_occurrence(IntrusiveList *list, IntrusiveLink *link, void *reference, int (*cmp_link)(IntrusiveLink *link, void *target));
+
+/*
+ * @Function intrusive_remove_first_occurrence
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList which will be modified #
+ * 		void *target
+ * 		# data to search in list #
+ * 		int (*cmp_link)(IntrusiveLink *link, void *target)
+ * 		# pointer to the function which compares the structure of a link with target #
+ * 		void (*free_link)(IntrusiveLink *link)
+ * 		# pointer to the function called on the unlinked link #
+ * 		# if NULL, the structure is only unlinked #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function unlinks the first occurrence of target from list, like intrusive_remove_all_occurrence.
+ * 		If target has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int intrusive_remove_first_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target), void (*free_link)(IntrusiveLink *link));
+
+/*
+ * @Function intrusive_remove_last_occurrence
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList which will be modified #
+ * 		void *target
+ * 		# data to search in list #
+ * 		int (*cmp_link)(IntrusiveLink *link, void *target)
+ * 		# pointer to the function which compares the structure of a link with target #
+ * 		void (*free_link)(IntrusiveLink *link)
+ * 		# pointer to the function called on the unlinked link #
+ * 		# if NULL, the structure is only unlinked #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function unlinks the last occurrence of target from list, like intrusive_remove_all_occurrence.
+ * 		If target has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int intrusive_remove_last_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target), void (*free_link)(IntrusiveLink *link));
+
+/*
+ * @Function intrusive_remove_all_occurrence
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList which will be modified #
+ * 		void *target
+ * 		# data to search in list #
+ * 		int (*cmp_link)(IntrusiveLink *link, void *target)
+ * 		# pointer to the function which compares the structure of a link with target #
+ * 		void (*free_link)(IntrusiveLink *link)
+ * 		# pointer to the function called on each unlinked link #
+ * 		# if NULL, the structures are only unlinked #
+ * @Return size_t # number of links removed #
+ * @Description
+ * 		This function unlinks all the occurrences of target from list, in one pass.
+ */
+extern size_t intrusive_remove_all_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target), void (*free_link)(IntrusiveLink *link));
+
+/*
+ * @Function intrusive_extract_first_occurrence
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList which will be modified #
+ * 		void *target
+ * 		# data to search in list #
+ * 		int (*cmp_link)(IntrusiveLink *link, void *target)
+ * 		# pointer to the function which compares the structure of a link with target #
+ * @Return IntrusiveLink * # link which was in list or NULL #
+ * @Description
+ * 		This function unlinks the first occurrence of target from list, and returns its link.
+ * 		If target is not present in list, it returns NULL.
+ */
+extern IntrusiveLink * intrusive_extract_first_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target));
+
+/*
+ * @Function intrusive_extract_last_occurrence
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList which will be modified #
+ * 		void *target
+ * 		# data to search in list #
+ * 		int (*cmp_link)(IntrusiveLink *link, void *target)
+ * 		# pointer to the function which compares the structure of a link with target #
+ * @Return IntrusiveLink * # link which was in list or NULL #
+ * @Description
+ * 		This function unlinks the last occurrence of target from list, and returns its link.
+ * 		If target is not present in list, it returns NULL.
+ */
+extern IntrusiveLink * intrusive_extract_last_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target));
+
+/*
+ * @Function intrusive_find_first_occurrence
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList to read #
+ * 		void *target
+ * 		# data to search in list #
+ * 		int (*cmp_link)(IntrusiveLink *link, void *target)
+ * 		# pointer to the function which compares the structure of a link with target #
+ * @Return IntrusiveLink * # link of the structure equal to target or NULL #
+ * @Description
+ * 		This function search the first occurrence of target in list.
+ * 		If target is not present in list, it returns NULL.
+ */
+extern IntrusiveLink * intrusive_find_first_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target));
+
+/*
+ * @Function intrusive_find_last_occurrence
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList to read #
+ * 		void *target
+ * 		# data to search in list #
+ * 		int (*cmp_link)(IntrusiveLink *link, void *target)
+ * 		# pointer to the function which compares the structure of a link with target #
+ * @Return IntrusiveLink * # link of the structure equal to target or NULL #
+ * @Description
+ * 		This function search the last occurrence of target in list.
+ * 		If target is not present in list, it returns NULL.
+ */
+extern IntrusiveLink * intrusive_find_last_occurrence(IntrusiveList *list, void *target, int (*cmp_link)(IntrusiveLink *link, void *target));
+
+/*
+ * @Function intrusive_list_size
+ * @Params
+ * 		IntrusiveList *list
+ * 		# IntrusiveList to read #
+ * @Return size_t # number of structures in list #
+ * @Description
+ * 		This function returns the number of structures in list, in O(1).
+ */
+extern size_t intrusive_list_size(IntrusiveList *list);
+
+
+#endif /* HEADER_INTRUSIVE_LIST_H_ */
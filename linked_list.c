@@ -1,8 +1,261 @@
+#define _POSIX_C_SOURCE 200112L
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <stdatomic.h>
 #include "linked_list.h"
+#include "linked_list_stats.h"
 
 
+#define DEFAULT_CELLS_PER_BLOCK 4096
+#define DEFAULT_WRITE_BUFFER_SIZE 65536
+#define FIND_HASH_THRESHOLD 8
+
+/* size and alignment of a slab, so a cell finds its slab by clearing the low bits of its address */
+#define CELL_SLAB_SIZE 65536
+#define CELL_SLAB_CAPACITY ((CELL_SLAB_SIZE - offsetof(struct _cell_slab, cells)) / sizeof(LinkedList))
+
+/* malloc(3) returns addresses aligned on max_align_t, the cells of a slab are all at an address which is not */
+#define IS_SLAB_CELL(cell) (((uintptr_t)(cell) % _Alignof(max_align_t)) != 0)
+#define CELL_SLAB(cell) ((struct _cell_slab *)((uintptr_t)(cell) & ~(uintptr_t)(CELL_SLAB_SIZE - 1)))
+
+
+struct _cell_slab {
+	struct _cell_slab *block; /* first slab of the block, whose next fields describe the block */
+	LinkedListPool *pool; /* pool which owns the block, NULL if the block is freed with its last cell */
+	struct _cell_slab *next; /* next block of the pool */
+	size_t count; /* number of cells of the block */
+	atomic_size_t live; /* number of cells of the block which are not freed yet, if it belongs to no pool */
+	LinkedList cells[]; /* contiguous cells */
+};
+/*
+ * Slab of CELL_SLAB_SIZE bytes, at an address aligned on CELL_SLAB_SIZE.
+ * A block of cells is made of consecutive slabs allocated in one call to posix_memalign(3),
+ * and is either a block of a pool, or a block of linked_list_from_array or of a compaction.
+ * A freed cell finds its block from its own address, so no table of the blocks is needed.
+ */
+
+_Static_assert(offsetof(struct _cell_slab, cells) % _Alignof(max_align_t) != 0
+		&& sizeof(LinkedList) % _Alignof(max_align_t) == 0,
+		"the cells of a slab must not be aligned like the addresses returned by malloc(3)");
+
+struct _linked_list_pool {
+	struct _cell_slab *blocks; /* first block of the pool */
+	struct _cell_slab *current; /* block where the new cells are taken */
+	unsigned int cells_per_block; /* number of cells in each block */
+	unsigned int used; /* number of cells already taken in the current block */
+	LinkedList *free_cells; /* cells given back to the pool, linked with 'next' */
+};
+/*
+ * The blocks after 'current' are kept by reset_linked_list_pool and reused before allocating new ones.
+ */
+
+
+struct _key_slot {
+	size_t index; /* index of the target in the array of targets, (size_t)-1 if the slot is empty */
+	unsigned long hash; /* hash of the target */
+};
+/*
+ * Slot of the temporary hash set of find_occurrences, with linear probing.
+ */
+
+
+/* pool used by the calling thread, NULL means malloc(3) */
+static _Thread_local LinkedListPool *current_pool = NULL;
+
+
+/*
+ * This function returns the cell at index in block.
+ */
+static LinkedList * block_cell(struct _cell_slab *block, size_t index) {
+
+	struct _cell_slab *slab = (struct _cell_slab *)((char *)block + (index / CELL_SLAB_CAPACITY) * CELL_SLAB_SIZE);
+
+	return &(slab->cells[index % CELL_SLAB_CAPACITY]);
+
+}
+
+/*
+ * This function allocates a block of count cells (count is not 0), in consecutive slabs.
+ * It returns NULL if there were an allocation problem.
+ */
+static struct _cell_slab * alloc_cell_block(LinkedListPool *pool, size_t count) {
+
+	struct _cell_slab *block, *slab;
+	size_t slabs = (count - 1) / CELL_SLAB_CAPACITY + 1, i;
+	void *memory;
+
+	if (slabs > ((size_t)-1) / CELL_SLAB_SIZE)
+		return NULL;
+	if (posix_memalign(&memory, CELL_SLAB_SIZE, (slabs - 1) * CELL_SLAB_SIZE + offsetof(struct _cell_slab, cells)
+			+ (count - (slabs - 1) * CELL_SLAB_CAPACITY) * sizeof(LinkedList)) != 0)
+		return NULL;
+
+	block = (struct _cell_slab *)memory;
+	for (i = 0; i < slabs; i++) {
+		slab = (struct _cell_slab *)((char *)memory + i * CELL_SLAB_SIZE);
+		slab->block = block;
+		slab->pool = pool;
+		slab->next = NULL;
+		slab->count = count;
+		atomic_init(&(slab->live), count);
+	}
+
+	return block;
+
+}
+
+/*
+ * This function creates an empty pool of LinkedList cells.
+ * It returns NULL if there were an allocation problem.
+ */
+LinkedListPool * create_linked_list_pool(unsigned int cells_per_block) {
+
+	LinkedListPool *pool = NULL;
+
+	pool = (LinkedListPool *)malloc(sizeof(LinkedListPool));
+	if (NULL == pool) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return NULL;
+	}
+
+	pool->blocks = NULL;
+	pool->current = NULL;
+	pool->cells_per_block = (0 == cells_per_block) ? DEFAULT_CELLS_PER_BLOCK : cells_per_block;
+	pool->used = 0;
+	pool->free_cells = NULL;
+
+	return pool;
+
+}
+
+/*
+ * This function releases all the blocks of the pool, without looking at the cells.
+ * At the end of the function, the pool points to the NULL pointer.
+ */
+void free_linked_list_pool(LinkedListPool **pool) {
+
+	struct _cell_slab *block, *save;
+
+	if (NULL == (*pool))
+		return;
+
+	if (current_pool == (*pool))
+		current_pool = NULL;
+
+	block = (*pool)->blocks;
+	while (block != NULL) {
+		save = block->next;
+		free(block);
+		block = save;
+	}
+
+	free(*pool);
+	*pool = NULL;
+
+}
+
+/*
+ * This function gives back all the cells of the pool in O(1).
+ * The blocks are kept and reused from the first one.
+ */
+void reset_linked_list_pool(LinkedListPool *pool) {
+
+	if (NULL == pool)
+		return;
+
+	pool->current = pool->blocks;
+	pool->used = 0;
+	pool->free_cells = NULL;
+
+}
+
+/*
+ * This function sets the pool used by the calling thread.
+ * It returns the pool previously used.
+ */
+LinkedListPool * use_linked_list_pool(LinkedListPool *pool) {
+
+	LinkedListPool *previous = current_pool;
+
+	current_pool = pool;
+
+	return previous;
+
+}
+
+/*
+ * This function takes a cell from the pool.
+ * The recycled cells are used first, then the current block, then a new block.
+ * It returns NULL if there were an allocation problem.
+ */
+static LinkedList * take_pool_cell(LinkedListPool *pool) {
+
+	LinkedList *cell;
+	struct _cell_slab *block;
+
+	if (pool->free_cells != NULL) {
+		cell = pool->free_cells;
+		pool->free_cells = cell->next;
+		return cell;
+	}
+
+	if (NULL == pool->current || pool->used == pool->cells_per_block) {
+		if (pool->current != NULL && pool->current->next != NULL) {
+			pool->current = pool->current->next;
+		} else {
+			block = alloc_cell_block(pool, pool->cells_per_block);
+			if (NULL == block)
+				return NULL;
+			if (NULL == pool->current)
+				pool->blocks = block;
+			else
+				pool->current->next = block;
+			pool->current = block;
+		}
+		pool->used = 0;
+	}
+
+	cell = block_cell(pool->current, pool->used);
+	pool->used += 1;
+
+	return cell;
+
+}
+
+/*
+ * This function frees a cell, without its data, where it comes from :
+ * a cell of a pool goes back to its pool, a cell of a block of no pool is counted off its block
+ * (the block is freed with its last cell), and the other cells are given back to free(3).
+ */
+static void free_cell(LinkedList *cell) {
+
+	struct _cell_slab *block;
+
+	if (!IS_SLAB_CELL(cell)) {
+		free(cell);
+		LINKED_LIST_COUNT_FREE(0);
+		return;
+	}
+
+	block = CELL_SLAB(cell)->block;
+	if (block->pool != NULL) {
+		cell->next = block->pool->free_cells;
+		block->pool->free_cells = cell;
+		LINKED_LIST_COUNT_FREE(1);
+		return;
+	}
+
+	if (atomic_fetch_sub_explicit(&(block->live), 1, memory_order_acq_rel) == 1)
+		free(block);
+	LINKED_LIST_COUNT_FREE(0);
+
+}
+
 /*
  * @Function alloc_linked_list
  * @Params
@@ -16,9 +269,10 @@
  *		struct _list *next
  *		# pointer to a LinkedList #
  *		# correspond to the second field of a LinkedList #
- * @Return LinkedList * # return a pointer to a new cell allocated with malloc(3) #
+ * @Return LinkedList * # return a pointer to a new cell allocated with malloc(3) or taken from the current pool #
  * @Description
- * 		This function create a LinkedList allocated with malloc(3).
+ * 		This function create a LinkedList allocated with malloc(3),
+ * 		or taken from the pool of the calling thread if there is one.
  * 		In this structure, data is put in the 'data' field,
  * 		and the 'next' field points on next.
  * 		If the LinkedList is correctly done, the function returns it.
@@ -28,11 +282,15 @@ static LinkedList * alloc_linked_list(void *data, void (*print_data)(void *data)
 
 	LinkedList *list = NULL;
 
-	list = (LinkedList *)malloc(sizeof(LinkedList));
+	if (current_pool != NULL)
+		list = take_pool_cell(current_pool);
+	else
+		list = (LinkedList *)malloc(sizeof(LinkedList));
 	if (NULL == list) {
 		fprintf(stderr, "error: allocation fail.\n");
 		return NULL;
 	}
+	LINKED_LIST_COUNT_ALLOCATION(current_pool != NULL);
 
 	list->data = data;
 	list->print_data = print_data;
@@ -46,35 +304,54 @@ static LinkedList * alloc_linked_list(void *data, void (*print_data)(void *data)
 /*
  * This function frees the memory space dedicated to the LinkedList in the parameters.
  * At the end of the function, the LinkedList points to the NULL pointer.
- * This function does it recursively.
- * WARNING : the free_data function cannot be NULL.
+ * This function does it iteratively, so that long lists do not overflow the stack.
+ * The data of a cell whose free_data is NULL are not freed.
  */
 void free_linked_list(LinkedList **list) {
 
-	if (NULL == (*list))
-		return;
+	LinkedList *tmp = *list, *save;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_FREE);
+
+	while (tmp != NULL) {
+		save = tmp->next;
+		if (tmp->free_data != NULL)
+			tmp->free_data(&(tmp->data));
+		free_cell(tmp);
+		tmp = save;
+	}
 
-	free_linked_list(&((*list)->next));
-	(*list)->free_data(&((*list)->data));
-	free(*list);
 	*list = NULL;
+	LINKED_LIST_PROBE_END();
+
+}
+
+/*
+ * This function frees one cell, without its data, where it comes from.
+ */
+void free_linked_list_cell(LinkedList *cell) {
+
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_FREE_CELL);
+
+	if (cell != NULL)
+		free_cell(cell);
+
+	LINKED_LIST_PROBE_END();
 
 }
 
 /*
  * This function displays all the LinkedList on the console.
- * This function does it recursively.
+ * This function does it iteratively, so that long lists do not overflow the stack.
  * WARNING : the print_data function cannot be NULL.
  */
 void print_linked_list(LinkedList *list) {
 
-	if (NULL == list) {
-		printf("\n");
-		return;
+	while (list != NULL) {
+		list->print_data(list->data);
+		list = list->next;
 	}
 
-	list->print_data(list->data);
-	print_linked_list(list->next);
+	printf("\n");
 
 }
 
@@ -82,23 +359,21 @@ void print_linked_list(LinkedList *list) {
  * This function displays all the LinkedList on the console.
  * Each data is separated by the string 'separator'.
  * If 'separator' is NULL, the separator is a space.
- * This function does it recursively.
+ * This function does it iteratively, so that long lists do not overflow the stack.
  * WARNING : the print_data function cannot be NULL.
  */
 void print_linked_list_with_separator(LinkedList *list, char *separator) {
 
-	if (NULL == list) {
-		printf("\n");
-		return;
+	while (list != NULL) {
+		list->print_data(list->data);
+		if (NULL == separator)
+			fputs(" ", stdout);
+		else if (list->next != NULL)
+			fputs(separator, stdout);
+		list = list->next;
 	}
 
-	list->print_data(list->data);
-	if (NULL == separator)
-		printf(" ");
-	else if (list->next != NULL)
-		printf("%s", separator);
-
-	print_linked_list_with_separator(list->next, separator);
+	printf("\n");
 
 }
 
@@ -109,9 +384,10 @@ void print_linked_list_with_separator(LinkedList *list, char *separator) {
  */
 int add_to_top(LinkedList **list, void *data, void (*print_data)(void *data), void (*free_data)(void **data)) {
 
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_TO_TOP);
 	*list = alloc_linked_list(data, print_data, free_data, *list);
 
-	return ((*list) != NULL);
+	LINKED_LIST_PROBE_RETURN(int, ((*list) != NULL));
 
 }
 
@@ -123,20 +399,21 @@ int add_to_top(LinkedList **list, void *data, void (*print_data)(void *data), vo
 int add_at_the_end(LinkedList **list, void *data, void (*print_data)(void *data), void (*free_data)(void **data)) {
 
 	LinkedList *tmp = *list;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_AT_THE_END);
 
 	if (NULL == (*list)) {
 		*list = alloc_linked_list(data, print_data, free_data, *list);
 		if (NULL == (*list))
-			return 0;
+			LINKED_LIST_PROBE_RETURN(int, 0);
 	} else {
 		while (tmp->next != NULL)
 			tmp = tmp->next;
 		tmp->next = alloc_linked_list(data, print_data, free_data, NULL);
 		if (NULL == tmp->next)
-			return 0;
+			LINKED_LIST_PROBE_RETURN(int, 0);
 	}
 
-	return 1;
+	LINKED_LIST_PROBE_RETURN(int, 1);
 
 }
 
@@ -149,24 +426,25 @@ int add_at_the_end(LinkedList **list, void *data, void (*print_data)(void *data)
 int add_after_first_occurrence(LinkedList **list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2)) {
 
 	LinkedList *tmp = *list;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_AFTER_FIRST_OCCURRENCE);
 
 	if (NULL == (*list) && reference != NULL) {
 		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
-		return 0;
+		LINKED_LIST_PROBE_RETURN(int, 0);
 	} else if (NULL == (*list) && NULL == reference) {
 		*list = alloc_linked_list(data, print_data, free_data, NULL);
-		return ((*list) != NULL);
+		LINKED_LIST_PROBE_RETURN(int, ((*list) != NULL));
 	} else {
 		if (NULL == reference)
-			return add_at_the_end(list, data, print_data, free_data);
-		while (tmp != NULL && cmp_data(reference, tmp->data) != 0)
+			LINKED_LIST_PROBE_RETURN(int, add_at_the_end(list, data, print_data, free_data));
+		while (tmp != NULL && LINKED_LIST_COMPARE(cmp_data, reference, tmp->data) != 0)
 			tmp = tmp->next;
 		if (NULL == tmp) {
 			fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
-			return 0;
+			LINKED_LIST_PROBE_RETURN(int, 0);
 		}
 		tmp->next = alloc_linked_list(data, print_data, free_data, tmp->next);
-		return (tmp->next != NULL);
+		LINKED_LIST_PROBE_RETURN(int, (tmp->next != NULL));
 	}
 
 }
@@ -180,26 +458,27 @@ int add_after_first_occurrence(LinkedList **list, void *data, void (*print_data)
 int add_before_first_occurrence(LinkedList **list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2)) {
 
 	LinkedList *tmp = *list;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_BEFORE_FIRST_OCCURRENCE);
 
 	if (NULL == (*list) && reference != NULL) {
 		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
-		return 0;
+		LINKED_LIST_PROBE_RETURN(int, 0);
 	} else if (NULL == (*list) && NULL == reference) {
 		*list = alloc_linked_list(data, print_data, free_data, NULL);
-		return ((*list) != NULL);
+		LINKED_LIST_PROBE_RETURN(int, ((*list) != NULL));
 	} else {
 		if (NULL == reference)
-			return add_at_the_end(list, data, print_data, free_data);
-		if (cmp_data(reference, (*list)->data) == 0)
-			return add_to_top(list, data, print_data, free_data);
-		while (tmp->next != NULL && cmp_data(reference, tmp->next->data) != 0)
+			LINKED_LIST_PROBE_RETURN(int, add_at_the_end(list, data, print_data, free_data));
+		if (LINKED_LIST_COMPARE(cmp_data, reference, (*list)->data) == 0)
+			LINKED_LIST_PROBE_RETURN(int, add_to_top(list, data, print_data, free_data));
+		while (tmp->next != NULL && LINKED_LIST_COMPARE(cmp_data, reference, tmp->next->data) != 0)
 			tmp = tmp->next;
 		if (NULL == tmp->next) {
 			fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
-			return 0;
+			LINKED_LIST_PROBE_RETURN(int, 0);
 		}
 		tmp->next = alloc_linked_list(data, print_data, free_data, tmp->next);
-		return (tmp->next != NULL);
+		LINKED_LIST_PROBE_RETURN(int, (tmp->next != NULL));
 	}
 
 }
@@ -213,28 +492,29 @@ int add_before_first_occurrence(LinkedList **list, void *data, void (*print_data
 int add_after_last_occurrence(LinkedList **list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2)) {
 
 	LinkedList *tmp = *list, *last = NULL;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_AFTER_LAST_OCCURRENCE);
 
 	if (NULL == (*list) && reference != NULL) {
 		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
-		return 0;
+		LINKED_LIST_PROBE_RETURN(int, 0);
 	} else if (NULL == (*list) && NULL == reference) {
 		*list = alloc_linked_list(data, print_data, free_data, NULL);
-		return ((*list) != NULL);
+		LINKED_LIST_PROBE_RETURN(int, ((*list) != NULL));
 	} else {
 		if (NULL == reference)
-			return add_at_the_end(list, data, print_data, free_data);
+			LINKED_LIST_PROBE_RETURN(int, add_at_the_end(list, data, print_data, free_data));
 		while (tmp != NULL) {
-			if (cmp_data(reference, tmp->data) == 0)
+			if (LINKED_LIST_COMPARE(cmp_data, reference, tmp->data) == 0)
 				last = tmp;
 			tmp = tmp->next;
 		}
 
 		if (NULL == last) {
 			fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
-			return 0;
+			LINKED_LIST_PROBE_RETURN(int, 0);
 		}
 		last->next = alloc_linked_list(data, print_data, free_data, last->next);
-		return (last->next != NULL);
+		LINKED_LIST_PROBE_RETURN(int, (last->next != NULL));
 	}
 
 }
@@ -248,20 +528,21 @@ int add_after_last_occurrence(LinkedList **list, void *data, void (*print_data)(
 int add_before_last_occurrence(LinkedList **list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2)) {
 
 	LinkedList *tmp = *list, *last = NULL;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_BEFORE_LAST_OCCURRENCE);
 
 	if (NULL == (*list) && reference != NULL) {
 		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
-		return 0;
+		LINKED_LIST_PROBE_RETURN(int, 0);
 	} else if (NULL == (*list) && NULL == reference) {
 		*list = alloc_linked_list(data, print_data, free_data, NULL);
-		return ((*list) != NULL);
+		LINKED_LIST_PROBE_RETURN(int, ((*list) != NULL));
 	} else {
 		if (NULL == reference)
-			return add_at_the_end(list, data, print_data, free_data);
-		if (cmp_data(reference, (*list)->data) == 0)
+			LINKED_LIST_PROBE_RETURN(int, add_at_the_end(list, data, print_data, free_data));
+		if (LINKED_LIST_COMPARE(cmp_data, reference, (*list)->data) == 0)
 			last = tmp;
 		while (tmp->next != NULL) {
-			if (cmp_data(reference, tmp->next->data) == 0) {
+			if (LINKED_LIST_COMPARE(cmp_data, reference, tmp->next->data) == 0) {
 				last = tmp;
 			}
 			tmp = tmp->next;
@@ -269,236 +550,1557 @@ int add_before_last_occurrence(LinkedList **list, void *data, void (*print_data)
 
 		if (NULL == last) {
 			fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
-			return 0;
+			LINKED_LIST_PROBE_RETURN(int, 0);
 		}
 		last->next = alloc_linked_list(data, print_data, free_data, last->next);
-		return (last->next != NULL);
+		LINKED_LIST_PROBE_RETURN(int, (last->next != NULL));
 	}
 
 }
 
 /*
- * This function add at the end of list the LinkedList list_to_add.
- * WARNING : This function just link list_to_add at the end of list,
- * so if you free(or modifies) an element common of the two list,
- * the other list will be modified too.
+ * This function search the link where cells are added after (or before if 'before' is not 0)
+ * the first (or the last if 'last' is not 0) occurrence of reference in list, in one pass.
+ * If reference is NULL, it is the link at the end of list.
+ * It returns the link, or NULL if reference has not been found.
  */
-void add_list(LinkedList **list, const LinkedList *list_to_add) {
+static LinkedList ** search_insertion_link(LinkedList **list, void *reference, int (*cmp_data)(void *data1, void *data2), int last, int before) {
 
-	LinkedList *tmp = *list;
+	LinkedList **link = list, **found = NULL;
 
-	if (NULL == list_to_add)
-		return;
+	if (NULL == reference) {
+		while (*link != NULL)
+			link = &((*link)->next);
+		return link;
+	}
 
-	if (NULL == (*list)) {
-		*list = (LinkedList *)list_to_add;
-		return;
+	while (*link != NULL) {
+		if (LINKED_LIST_COMPARE(cmp_data, reference, (*link)->data) == 0) {
+			found = before ? link : &((*link)->next);
+			if (!last)
+				break;
+		}
+		link = &((*link)->next);
 	}
 
-	while (tmp->next != NULL)
-		tmp = tmp->next;
+	if (NULL == found)
+		fprintf(stderr, "WARNING: You want to add %s an element that not exist.\n", before ? "before" : "after");
 
-	tmp->next = (LinkedList *)list_to_add;
+	return found;
 
 }
 
 /*
- * This function remove the first occurrence of target_data in list.
- * WARNING: We suppose that cmp_data can compare all the elements of list.
- * If target_data has not been found, it returns 0.
+ * This function adds the data of array at the link found by search_insertion_link.
+ * It returns 0 if there were an allocation problem or reference not found.
  * Else it returns 1.
  */
-int remove_first_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
-
-	LinkedList *tmp = *list, *save;
-
-	if (NULL == (*list))
-		return 0;
+static int add_array_at_occurrence(LinkedList **list, void **array, size_t size, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2), int last, int before) {
 
-	while (tmp->next != NULL && cmp_data(tmp->next->data, target_data) != 0)
-		tmp = tmp->next;
+	LinkedList **link = search_insertion_link(list, reference, cmp_data, last, before);
 
-	if (NULL == tmp->next) {
-		if (cmp_data(tmp->data, target_data) == 0) {
-			free_linked_list(list);
-			return 1;
-		}
+	if (NULL == link)
 		return 0;
-	}
-
-	save = tmp->next;
-	tmp->next = tmp->next->next;
-	free(save);
-	save = NULL;
 
-	return 1;
+	return linked_list_from_array(link, array, size, print_data, free_data);
 
 }
 
 /*
- * This function remove the first occurrence of target_data in list.
- * WARNING: We suppose that cmp_data can compare all the elements of list.
- * If target_data has not been found, it returns 0.
+ * This function links chain at the link found by search_insertion_link.
+ * It returns 0 if reference not found.
  * Else it returns 1.
  */
-int remove_last_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
-
-	LinkedList *tmp = *list, *save, *last = NULL;
+static int add_chain_at_occurrence(LinkedList **list, LinkedList *chain, void *reference, int (*cmp_data)(void *data1, void *data2), int last, int before) {
 
-	if (NULL == (*list))
-		return 0;
-
-	if (NULL == tmp->next) {
-		if (cmp_data(tmp->data, target_data) == 0) {
-			free_linked_list(list);
-			return 1;
-		}
-		return 0;
-	}
+	LinkedList **link = search_insertion_link(list, reference, cmp_data, last, before), *chain_last = chain;
 
-	while (tmp->next != NULL) {
-		if (cmp_data(tmp->next->data, target_data) == 0)
-			last = tmp;
-		tmp = tmp->next;
-	}
-
-	if (NULL == last)
+	if (NULL == link)
 		return 0;
+	if (NULL == chain)
+		return 1;
 
-	save = last->next;
-	last->next = last->next->next;
-	free(save);
-	save = NULL;
+	while (chain_last->next != NULL)
+		chain_last = chain_last->next;
 
-	return 1;
+	return splice_linked_list(&chain, chain_last, link);
 
 }
 
+/*
+ * This function add after the first occurrence of reference in the LinkedList, the data of array, in one pass.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int add_array_after_first_occurrence(LinkedList **list, void **array, size_t size, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2)) {
 
-void remove_all_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_ARRAY_AFTER_FIRST_OCCURRENCE);
 
-	while (remove_first_occurrence(list, target_data, cmp_data) != 0);
+	LINKED_LIST_PROBE_RETURN(int, add_array_at_occurrence(list, array, size, print_data, free_data, reference, cmp_data, 0, 0));
 
 }
 
 /*
- * This function extract the first occurrence of target_data in list.
- * It returns a LinkedList corresponding to where the function found target_data in list.
- * If target_data is not present in list, it returns NULL.
- * WARNING: We suppose that cmp_data can compare all the elements of list.
+ * This function add after the last occurrence of reference in the LinkedList, the data of array, in one pass.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
  */
-LinkedList * extract_first_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+int add_array_after_last_occurrence(LinkedList **list, void **array, size_t size, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2)) {
 
-	LinkedList *tmp = *list, *save;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_ARRAY_AFTER_LAST_OCCURRENCE);
 
-	if (NULL == (*list))
-		return NULL;
+	LINKED_LIST_PROBE_RETURN(int, add_array_at_occurrence(list, array, size, print_data, free_data, reference, cmp_data, 1, 0));
 
-	while (tmp->next != NULL && cmp_data(tmp->next->data, target_data) != 0)
-		tmp = tmp->next;
+}
 
-	if (NULL == tmp->next) {
-		if (cmp_data(tmp->data, target_data) == 0) {
-			save = *list;
-			*list = NULL;
-			return save;
-		}
-		return NULL;
-	}
+/*
+ * This function add before the first occurrence of reference in the LinkedList, the data of array, in one pass.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int add_array_before_first_occurrence(LinkedList **list, void **array, size_t size, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2)) {
 
-	save = tmp->next;
-	tmp->next = tmp->next->next;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_ARRAY_BEFORE_FIRST_OCCURRENCE);
 
-	return save;
+	LINKED_LIST_PROBE_RETURN(int, add_array_at_occurrence(list, array, size, print_data, free_data, reference, cmp_data, 0, 1));
 
 }
 
 /*
- * This function extract the last occurrence of target_data in list.
- * It returns a LinkedList corresponding to where the function found target_data in list.
- * If target_data is not present in list, it returns NULL.
- * WARNING: We suppose that cmp_data can compare all the elements of list.
+ * This function add before the last occurrence of reference in the LinkedList, the data of array, in one pass.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
  */
-LinkedList * extract_last_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
-
-	LinkedList *tmp = *list, *save, *last = NULL;
+int add_array_before_last_occurrence(LinkedList **list, void **array, size_t size, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2)) {
 
-	if (NULL == (*list))
-		return NULL;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_ARRAY_BEFORE_LAST_OCCURRENCE);
 
-	if (NULL == tmp->next) {
-		if (cmp_data(tmp->data, target_data) == 0) {
-			save = *list;
-			*list = NULL;
-			return save;
-		}
-		return NULL;
-	}
+	LINKED_LIST_PROBE_RETURN(int, add_array_at_occurrence(list, array, size, print_data, free_data, reference, cmp_data, 1, 1));
 
-	while (tmp->next != NULL) {
-		if (cmp_data(tmp->next->data, target_data) == 0)
-			last = tmp;
-		tmp = tmp->next;
-	}
+}
 
-	if (NULL == last)
-		return 0;
+/*
+ * This function links chain after the first occurrence of reference in the LinkedList, in one pass.
+ * It returns 0 if reference not found.
+ * Else it returns 1.
+ */
+int add_chain_after_first_occurrence(LinkedList **list, LinkedList *chain, void *reference, int (*cmp_data)(void *data1, void *data2)) {
 
-	save = last->next;
-	last->next = last->next->next;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_CHAIN_AFTER_FIRST_OCCURRENCE);
 
-	return save;
+	LINKED_LIST_PROBE_RETURN(int, add_chain_at_occurrence(list, chain, reference, cmp_data, 0, 0));
 
 }
 
 /*
- * This function search the first occurrence of target_data in list.
- * It returns a LinkedList corresponding to where the function found target_data in list.
- * If target_data is not present in list, it returns NULL.
- * WARNING: We suppose that cmp_data can compare all the elements of list.
+ * This function links chain after the last occurrence of reference in the LinkedList, in one pass.
+ * It returns 0 if reference not found.
+ * Else it returns 1.
  */
-LinkedList * find_first_occurrence(LinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+int add_chain_after_last_occurrence(LinkedList **list, LinkedList *chain, void *reference, int (*cmp_data)(void *data1, void *data2)) {
 
-	while (list != NULL && cmp_data(list->data, target_data) != 0)
-		list = list->next;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_CHAIN_AFTER_LAST_OCCURRENCE);
 
-	return list;
+	LINKED_LIST_PROBE_RETURN(int, add_chain_at_occurrence(list, chain, reference, cmp_data, 1, 0));
 
 }
 
 /*
- * This function search the last occurrence of target_data in list.
+ * This function links chain before the first occurrence of reference in the LinkedList, in one pass.
+ * It returns 0 if reference not found.
+ * Else it returns 1.
+ */
+int add_chain_before_first_occurrence(LinkedList **list, LinkedList *chain, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_CHAIN_BEFORE_FIRST_OCCURRENCE);
+
+	LINKED_LIST_PROBE_RETURN(int, add_chain_at_occurrence(list, chain, reference, cmp_data, 0, 1));
+
+}
+
+/*
+ * This function links chain before the last occurrence of reference in the LinkedList, in one pass.
+ * It returns 0 if reference not found.
+ * Else it returns 1.
+ */
+int add_chain_before_last_occurrence(LinkedList **list, LinkedList *chain, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_CHAIN_BEFORE_LAST_OCCURRENCE);
+
+	LINKED_LIST_PROBE_RETURN(int, add_chain_at_occurrence(list, chain, reference, cmp_data, 1, 1));
+
+}
+
+/*
+ * This function add the data in parameters in a list sorted by cmp_data, after the data equal to it.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int add_sorted(LinkedList **list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList **link = list;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_SORTED);
+
+	while (*link != NULL && LINKED_LIST_COMPARE(cmp_data, (*link)->data, data) <= 0)
+		link = &((*link)->next);
+
+	LINKED_LIST_PROBE_RETURN(int, add_to_top(link, data, print_data, free_data));
+
+}
+
+/*
+ * This function add at the end of list the LinkedList list_to_add.
+ * WARNING : This function just link list_to_add at the end of list,
+ * so if you free(or modifies) an element common of the two list,
+ * the other list will be modified too.
+ */
+void add_list(LinkedList **list, const LinkedList *list_to_add) {
+
+	LinkedList *tmp = *list;
+
+	if (NULL == list_to_add)
+		return;
+
+	if (NULL == (*list)) {
+		*list = (LinkedList *)list_to_add;
+		return;
+	}
+
+	while (tmp->next != NULL)
+		tmp = tmp->next;
+
+	tmp->next = (LinkedList *)list_to_add;
+
+}
+
+/*
+ * This function moves the cells from *link to last into destination, in O(1).
+ * It returns 0 if the range is empty.
+ * Else it returns 1.
+ */
+int splice_linked_list(LinkedList **link, LinkedList *last, LinkedList **destination) {
+
+	LinkedList *first = *link;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_SPLICE);
+
+	if (NULL == first || NULL == last)
+		LINKED_LIST_PROBE_RETURN(int, 0);
+
+	*link = last->next;
+	last->next = *destination;
+	*destination = first;
+
+	LINKED_LIST_PROBE_RETURN(int, 1);
+
+}
+
+/*
+ * This function cuts list after its first position cells.
+ * It returns the cells after the cut, or NULL.
+ */
+LinkedList * split_linked_list_at(LinkedList **list, size_t position) {
+
+	LinkedList **link = list, *rest;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_SPLIT_AT);
+
+	while (*link != NULL && position > 0) {
+		LINKED_LIST_VISIT();
+		link = &((*link)->next);
+		position -= 1;
+	}
+
+	rest = *link;
+	*link = NULL;
+
+	LINKED_LIST_PROBE_RETURN(LinkedList *, rest);
+
+}
+
+/*
+ * This function cuts list before the first occurrence of target_data.
+ * It returns the cells from this occurrence, or NULL if target_data has not been found.
+ */
+LinkedList * split_linked_list_at_first_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList **link = list, *rest;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_SPLIT_AT_FIRST_OCCURRENCE);
+
+	while (*link != NULL && LINKED_LIST_COMPARE(cmp_data, (*link)->data, target_data) != 0)
+		link = &((*link)->next);
+
+	rest = *link;
+	*link = NULL;
+
+	LINKED_LIST_PROBE_RETURN(LinkedList *, rest);
+
+}
+
+/*
+ * This function cuts list into count parts whose sizes differ by at most one cell.
+ * It returns the number of cells of list.
+ */
+size_t split_linked_list_in_parts(LinkedList **list, LinkedList **parts, size_t count) {
+
+	LinkedList *tmp;
+	size_t size = 0, part, length;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_SPLIT_IN_PARTS);
+
+	for (tmp = *list; tmp != NULL; tmp = tmp->next) {
+		LINKED_LIST_VISIT();
+		size += 1;
+	}
+	if (0 == count)
+		LINKED_LIST_PROBE_RETURN(size_t, size);
+
+	/* the first size % count parts have one more cell */
+	for (part = 0; part < count; part++) {
+		length = size / count + ((part < size % count) ? 1 : 0);
+		parts[part] = (0 == length) ? NULL : *list;
+		*list = split_linked_list_at(list, length);
+	}
+
+	LINKED_LIST_PROBE_RETURN(size_t, size);
+
+}
+
+/*
+ * This function merges the sorted list_to_merge into the sorted list, in one pass.
+ * For equal data, the cells of list come first.
+ * No cell is allocated or freed.
+ */
+void merge_linked_list(LinkedList **list, LinkedList *list_to_merge, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList **link = list, *tmp = *list;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_MERGE);
+
+	while (tmp != NULL && list_to_merge != NULL) {
+		if (LINKED_LIST_COMPARE(cmp_data, tmp->data, list_to_merge->data) <= 0) {
+			*link = tmp;
+			tmp = tmp->next;
+		} else {
+			*link = list_to_merge;
+			list_to_merge = list_to_merge->next;
+		}
+		link = &((*link)->next);
+	}
+
+	*link = (NULL == tmp) ? list_to_merge : tmp;
+	LINKED_LIST_PROBE_END();
+
+}
+
+/*
+ * This function sorts list with cmp_data, with a bottom-up merge sort.
+ * The sort is stable, in O(n log n), without recursion nor allocation.
+ */
+void sort_linked_list(LinkedList **list, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList *p, *q, *cell, *tail;
+	size_t run = 1, merges, p_size, q_size, i;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_SORT);
+
+	if (NULL == (*list))
+		LINKED_LIST_PROBE_RETURN_VOID();
+
+	do {
+		p = *list;
+		*list = NULL;
+		tail = NULL;
+		merges = 0;
+
+		while (p != NULL) {
+			/* merge the run starting at p with the run which follows it */
+			merges += 1;
+			q = p;
+			p_size = 0;
+			for (i = 0; i < run && q != NULL; i++) {
+				p_size += 1;
+				q = q->next;
+			}
+			q_size = run;
+
+			while (p_size > 0 || (q_size > 0 && q != NULL)) {
+				if (0 == p_size) {
+					cell = q;
+					q = q->next;
+					q_size -= 1;
+				} else if (0 == q_size || NULL == q || LINKED_LIST_COMPARE(cmp_data, p->data, q->data) <= 0) {
+					cell = p;
+					p = p->next;
+					p_size -= 1;
+				} else {
+					cell = q;
+					q = q->next;
+					q_size -= 1;
+				}
+				if (NULL == tail)
+					*list = cell;
+				else
+					tail->next = cell;
+				tail = cell;
+			}
+
+			p = q;
+		}
+
+		tail->next = NULL;
+		run *= 2;
+	} while (merges > 1);
+	LINKED_LIST_PROBE_END();
+
+}
+
+/*
+ * This function remove the first occurrence of target_data in list.
+ * WARNING: We suppose that cmp_data can compare all the elements of list.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int remove_first_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList *tmp = *list, *save;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_REMOVE_FIRST_OCCURRENCE);
+
+	if (NULL == (*list))
+		LINKED_LIST_PROBE_RETURN(int, 0);
+
+	while (tmp->next != NULL && LINKED_LIST_COMPARE(cmp_data, tmp->next->data, target_data) != 0)
+		tmp = tmp->next;
+
+	if (NULL == tmp->next) {
+		if (LINKED_LIST_COMPARE(cmp_data, tmp->data, target_data) == 0) {
+			free_linked_list(list);
+			LINKED_LIST_PROBE_RETURN(int, 1);
+		}
+		LINKED_LIST_PROBE_RETURN(int, 0);
+	}
+
+	save = tmp->next;
+	tmp->next = tmp->next->next;
+	free_cell(save);
+	save = NULL;
+
+	LINKED_LIST_PROBE_RETURN(int, 1);
+
+}
+
+/*
+ * This function remove the first occurrence of target_data in list.
+ * WARNING: We suppose that cmp_data can compare all the elements of list.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int remove_last_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList *tmp = *list, *save, *last = NULL;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_REMOVE_LAST_OCCURRENCE);
+
+	if (NULL == (*list))
+		LINKED_LIST_PROBE_RETURN(int, 0);
+
+	if (NULL == tmp->next) {
+		if (LINKED_LIST_COMPARE(cmp_data, tmp->data, target_data) == 0) {
+			free_linked_list(list);
+			LINKED_LIST_PROBE_RETURN(int, 1);
+		}
+		LINKED_LIST_PROBE_RETURN(int, 0);
+	}
+
+	while (tmp->next != NULL) {
+		if (LINKED_LIST_COMPARE(cmp_data, tmp->next->data, target_data) == 0)
+			last = tmp;
+		tmp = tmp->next;
+	}
+
+	if (NULL == last)
+		LINKED_LIST_PROBE_RETURN(int, 0);
+
+	save = last->next;
+	last->next = last->next->next;
+	free_cell(save);
+	save = NULL;
+
+	LINKED_LIST_PROBE_RETURN(int, 1);
+
+}
+
+/*
+ * This function remove all occurrences of target_data in list, in one pass.
+ * Like remove_first_occurrence, the cells are freed but not their data.
+ * WARNING: We suppose that cmp_data can compare all the elements of list.
+ */
+void remove_all_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList **link = list, *tmp;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_REMOVE_ALL_OCCURRENCE);
+
+	while ((tmp = *link) != NULL) {
+		if (LINKED_LIST_COMPARE(cmp_data, tmp->data, target_data) == 0) {
+			*link = tmp->next;
+			free_cell(tmp);
+		} else {
+			link = &(tmp->next);
+		}
+	}
+	LINKED_LIST_PROBE_END();
+
+}
+
+/*
+ * This function remove from list all the cells whose data verify predicate, in one pass.
+ * The data of the removed cells are freed with their free_data.
+ * It returns the number of removed elements.
+ */
+size_t remove_if(LinkedList **list, int (*predicate)(void *data, void *context), void *context) {
+
+	LinkedList **link = list, *tmp;
+	size_t count = 0;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_REMOVE_IF);
+
+	while ((tmp = *link) != NULL) {
+		if (LINKED_LIST_TEST(predicate, tmp->data, context)) {
+			*link = tmp->next;
+			if (tmp->free_data != NULL)
+				tmp->free_data(&(tmp->data));
+			free_cell(tmp);
+			count += 1;
+		} else {
+			link = &(tmp->next);
+		}
+	}
+
+	LINKED_LIST_PROBE_RETURN(size_t, count);
+
+}
+
+/*
+ * This function keeps in list only the cells whose data verify predicate, in one pass.
+ * The other cells are linked together, in their order, and returned.
+ * No cell is allocated or freed.
+ */
+LinkedList * filter_linked_list(LinkedList **list, int (*predicate)(void *data, void *context), void *context) {
+
+	LinkedList **link = list, *tmp, *removed = NULL, **removed_link = &removed;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_FILTER);
+
+	while ((tmp = *link) != NULL) {
+		if (LINKED_LIST_TEST(predicate, tmp->data, context)) {
+			link = &(tmp->next);
+		} else {
+			*link = tmp->next;
+			*removed_link = tmp;
+			removed_link = &(tmp->next);
+		}
+	}
+	*removed_link = NULL;
+
+	LINKED_LIST_PROBE_RETURN(LinkedList *, removed);
+
+}
+
+/*
+ * This function extract the first occurrence of target_data in list.
  * It returns a LinkedList corresponding to where the function found target_data in list.
  * If target_data is not present in list, it returns NULL.
  * WARNING: We suppose that cmp_data can compare all the elements of list.
  */
-LinkedList * find_last_occurrence(LinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+LinkedList * extract_first_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
 
-	LinkedList *last = NULL;
+	LinkedList *tmp = *list, *save;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_EXTRACT_FIRST_OCCURRENCE);
 
-	while (list != NULL) {
-		if (cmp_data(list->data, target_data) == 0)
-			last = list;
-		list = list->next;
+	if (NULL == (*list))
+		LINKED_LIST_PROBE_RETURN(LinkedList *, NULL);
+
+	while (tmp->next != NULL && LINKED_LIST_COMPARE(cmp_data, tmp->next->data, target_data) != 0)
+		tmp = tmp->next;
+
+	if (NULL == tmp->next) {
+		if (LINKED_LIST_COMPARE(cmp_data, tmp->data, target_data) == 0) {
+			save = *list;
+			*list = NULL;
+			LINKED_LIST_PROBE_RETURN(LinkedList *, save);
+		}
+		LINKED_LIST_PROBE_RETURN(LinkedList *, NULL);
 	}
 
-	return last;
+	save = tmp->next;
+	tmp->next = tmp->next->next;
+
+	LINKED_LIST_PROBE_RETURN(LinkedList *, save);
 
 }
 
 /*
- * This function counts the elements in list.
- * It returns the number of elements in list.
+ * This function extract the last occurrence of target_data in list.
+ * It returns a LinkedList corresponding to where the function found target_data in list.
+ * If target_data is not present in list, it returns NULL.
+ * WARNING: We suppose that cmp_data can compare all the elements of list.
  */
-unsigned int linked_list_size(LinkedList *list) {
+LinkedList * extract_last_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
 
-	unsigned int count = 0;
+	LinkedList *tmp = *list, *save, *last = NULL;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_EXTRACT_LAST_OCCURRENCE);
 
-	while (list != NULL) {
-		count += 1;
-		list = list->next;
+	if (NULL == (*list))
+		LINKED_LIST_PROBE_RETURN(LinkedList *, NULL);
+
+	if (NULL == tmp->next) {
+		if (LINKED_LIST_COMPARE(cmp_data, tmp->data, target_data) == 0) {
+			save = *list;
+			*list = NULL;
+			LINKED_LIST_PROBE_RETURN(LinkedList *, save);
+		}
+		LINKED_LIST_PROBE_RETURN(LinkedList *, NULL);
+	}
+
+	while (tmp->next != NULL) {
+		if (LINKED_LIST_COMPARE(cmp_data, tmp->next->data, target_data) == 0)
+			last = tmp;
+		tmp = tmp->next;
 	}
 
-	return count;
+	if (NULL == last)
+		LINKED_LIST_PROBE_RETURN(LinkedList *, 0);
+
+	save = last->next;
+	last->next = last->next->next;
+
+	LINKED_LIST_PROBE_RETURN(LinkedList *, save);
+
+}
+
+/*
+ * This function search the first occurrence of target_data in list.
+ * It returns a LinkedList corresponding to where the function found target_data in list.
+ * If target_data is not present in list, it returns NULL.
+ * WARNING: We suppose that cmp_data can compare all the elements of list.
+ */
+LinkedList * find_first_occurrence(LinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_FIND_FIRST_OCCURRENCE);
+	while (list != NULL && LINKED_LIST_COMPARE(cmp_data, list->data, target_data) != 0)
+		list = list->next;
+
+	LINKED_LIST_PROBE_RETURN(LinkedList *, list);
+
+}
+
+/*
+ * This function search the last occurrence of target_data in list.
+ * It returns a LinkedList corresponding to where the function found target_data in list.
+ * If target_data is not present in list, it returns NULL.
+ * WARNING: We suppose that cmp_data can compare all the elements of list.
+ */
+LinkedList * find_last_occurrence(LinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList *last = NULL;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_FIND_LAST_OCCURRENCE);
+
+	while (list != NULL) {
+		if (LINKED_LIST_COMPARE(cmp_data, list->data, target_data) == 0)
+			last = list;
+		list = list->next;
+	}
+
+	LINKED_LIST_PROBE_RETURN(LinkedList *, last);
+
+}
+
+/*
+ * This function records that cell is an occurrence of the target 'index'.
+ * It returns 1 if it is the first occurrence of this target.
+ * Else it returns 0.
+ */
+static int record_occurrence(size_t index, LinkedList *cell, LinkedList **first, LinkedList **last) {
+
+	int new_target = (NULL == first) ? (NULL == last[index]) : (NULL == first[index]);
+
+	if (first != NULL && NULL == first[index])
+		first[index] = cell;
+	if (last != NULL)
+		last[index] = cell;
+
+	return new_target;
+
+}
+
+/*
+ * This function puts the targets in a hash set of 'capacity' slots (a power of two).
+ * A target equal to a previous one is not added : alias[i] receives the index of the target kept for it.
+ * It returns the number of distinct targets.
+ */
+static size_t fill_key_set(struct _key_slot *slots, size_t capacity, size_t *alias, void **targets, size_t count, int (*cmp_data)(void *data1, void *data2), unsigned long (*hash_data)(void *data)) {
+
+	size_t i, slot, distinct = 0;
+	unsigned long hash;
+
+	for (slot = 0; slot < capacity; slot++)
+		slots[slot].index = (size_t)-1;
+
+	for (i = 0; i < count; i++) {
+		hash = hash_data(targets[i]);
+		slot = hash & (capacity - 1);
+		while (slots[slot].index != (size_t)-1 && (slots[slot].hash != hash || LINKED_LIST_COMPARE(cmp_data, targets[slots[slot].index], targets[i]) != 0))
+			slot = (slot + 1) & (capacity - 1);
+		if (slots[slot].index == (size_t)-1) {
+			slots[slot].index = i;
+			slots[slot].hash = hash;
+			distinct += 1;
+		}
+		alias[i] = slots[slot].index;
+	}
+
+	return distinct;
+
+}
+
+/*
+ * This function searches the targets of a hash set in one traversal of list.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+static int find_with_key_set(LinkedList *list, void **targets, size_t count, int (*cmp_data)(void *data1, void *data2), unsigned long (*hash_data)(void *data), LinkedList **first, LinkedList **last) {
+
+	struct _key_slot *slots;
+	size_t *alias, capacity = 16, slot, remaining, i;
+	unsigned long hash;
+
+	while (capacity < 2 * count)
+		capacity *= 2;
+	slots = (struct _key_slot *)malloc(capacity * sizeof(struct _key_slot) + count * sizeof(size_t));
+	if (NULL == slots)
+		return 0;
+	alias = (size_t *)(slots + capacity);
+
+	remaining = fill_key_set(slots, capacity, alias, targets, count, cmp_data, hash_data);
+	for (; list != NULL && (last != NULL || remaining > 0); list = list->next) {
+		hash = hash_data(list->data);
+		slot = hash & (capacity - 1);
+		while (slots[slot].index != (size_t)-1) {
+			if (slots[slot].hash == hash && LINKED_LIST_COMPARE(cmp_data, list->data, targets[slots[slot].index]) == 0) {
+				remaining -= record_occurrence(slots[slot].index, list, first, last);
+				break;
+			}
+			slot = (slot + 1) & (capacity - 1);
+		}
+	}
+
+	/* the equal targets share the occurrences of the one kept in the set */
+	for (i = 0; i < count; i++) {
+		if (alias[i] == i)
+			continue;
+		if (first != NULL)
+			first[i] = first[alias[i]];
+		if (last != NULL)
+			last[i] = last[alias[i]];
+	}
+
+	free(slots);
+
+	return 1;
+
+}
+
+/*
+ * This function searches all the targets in one traversal of list.
+ * It returns the number of targets found.
+ */
+size_t find_occurrences(LinkedList *list, void **targets, size_t count, int (*cmp_data)(void *data1, void *data2), unsigned long (*hash_data)(void *data), LinkedList **first, LinkedList **last) {
+
+	size_t i, remaining = count, found = 0;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_FIND_OCCURRENCES);
+
+	if (NULL == first && NULL == last)
+		LINKED_LIST_PROBE_RETURN(size_t, 0);
+
+	for (i = 0; i < count; i++) {
+		if (first != NULL)
+			first[i] = NULL;
+		if (last != NULL)
+			last[i] = NULL;
+	}
+
+	if (NULL == hash_data || count <= FIND_HASH_THRESHOLD || !find_with_key_set(list, targets, count, cmp_data, hash_data, first, last)) {
+		for (; list != NULL && (last != NULL || remaining > 0); list = list->next)
+			for (i = 0; i < count; i++)
+				if (LINKED_LIST_COMPARE(cmp_data, list->data, targets[i]) == 0)
+					remaining -= record_occurrence(i, list, first, last);
+	}
+
+	for (i = 0; i < count; i++)
+		if ((NULL == first) ? (last[i] != NULL) : (first[i] != NULL))
+			found += 1;
+
+	LINKED_LIST_PROBE_RETURN(size_t, found);
+
+}
+
+/*
+ * This function counts the elements in list.
+ * It returns the number of elements in list.
+ */
+unsigned int linked_list_size(LinkedList *list) {
+
+	unsigned int count = 0;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_SIZE);
+
+	while (list != NULL) {
+		LINKED_LIST_VISIT();
+		count += 1;
+		list = list->next;
+	}
+
+	LINKED_LIST_PROBE_RETURN(unsigned int, count);
+
+}
+
+/*
+ * This function adds the data of array to the top of list, in cells allocated in one contiguous block.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int linked_list_from_array(LinkedList **list, void **array, size_t size, void (*print_data)(void *data), void (*free_data)(void **data)) {
+
+	struct _cell_slab *block;
+	LinkedList *first = NULL, **link = &first, *cell;
+	size_t i;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_FROM_ARRAY);
+
+	if (0 == size)
+		LINKED_LIST_PROBE_RETURN(int, 1);
+
+	block = alloc_cell_block(NULL, size);
+	if (NULL == block) {
+		fprintf(stderr, "error: allocation fail.\n");
+		LINKED_LIST_PROBE_RETURN(int, 0);
+	}
+
+	for (i = 0; i < size; i++) {
+		cell = block_cell(block, i);
+		cell->data = array[i];
+		cell->print_data = print_data;
+		cell->free_data = free_data;
+		*link = cell;
+		link = &(cell->next);
+		LINKED_LIST_COUNT_ALLOCATION(0);
+	}
+	*link = *list;
+	*list = first;
+
+	LINKED_LIST_PROBE_RETURN(int, 1);
+
+}
+
+/*
+ * This function writes the data of list in array, until the end of list or of array.
+ * It returns the number of data written.
+ */
+size_t linked_list_to_array(LinkedList *list, void **array, size_t size) {
+
+	size_t count = 0;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_TO_ARRAY);
+
+	while (list != NULL && count < size) {
+		LINKED_LIST_VISIT();
+		array[count] = list->data;
+		count += 1;
+		list = list->next;
+	}
+
+	LINKED_LIST_PROBE_RETURN(size_t, count);
+
+}
+
+/*
+ * This function prepares the incremental compaction of list.
+ */
+void begin_linked_list_compaction(LinkedListCompaction *compaction, LinkedList **list) {
+
+	compaction->list = list;
+	compaction->link = (NULL == (*list)) ? NULL : list;
+
+}
+
+/*
+ * This function moves the next max_cells cells of the compaction into a new block of contiguous cells.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int linked_list_compact_step(LinkedListCompaction *compaction, size_t max_cells) {
+
+	struct _cell_slab *block;
+	LinkedList *tmp, *save, **link, *cell;
+	size_t count = 0, i;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_COMPACT_STEP);
+
+	if (NULL == compaction->link || 0 == max_cells)
+		LINKED_LIST_PROBE_RETURN(int, 1);
+
+	/* the list was emptied between two steps */
+	if (NULL == *(compaction->list)) {
+		compaction->link = NULL;
+		LINKED_LIST_PROBE_RETURN(int, 1);
+	}
+	for (tmp = *(compaction->link); tmp != NULL && count < max_cells; tmp = tmp->next) {
+		LINKED_LIST_VISIT();
+		count += 1;
+	}
+	if (0 == count) {
+		compaction->link = NULL;
+		LINKED_LIST_PROBE_RETURN(int, 1);
+	}
+
+	block = alloc_cell_block(NULL, count);
+	if (NULL == block) {
+		fprintf(stderr, "error: allocation fail.\n");
+		LINKED_LIST_PROBE_RETURN(int, 0);
+	}
+
+	link = compaction->link;
+	tmp = *link;
+	for (i = 0; i < count; i++) {
+		cell = block_cell(block, i);
+		save = tmp->next;
+		*cell = *tmp;
+		*link = cell;
+		link = &(cell->next);
+		LINKED_LIST_COUNT_ALLOCATION(0);
+		free_cell(tmp);
+		tmp = save;
+	}
+	*link = tmp;
+	compaction->link = (NULL == tmp) ? NULL : link;
+
+	LINKED_LIST_PROBE_RETURN(int, 1);
+
+}
+
+/*
+ * This function tells if all the cells of the compaction have been relocated.
+ */
+int linked_list_compaction_done(const LinkedListCompaction *compaction) {
+
+	return (NULL == compaction->link);
+
+}
+
+/*
+ * This function moves all the cells of list into a new block of contiguous cells, in O(n).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int linked_list_compact(LinkedList **list) {
+
+	LinkedListCompaction compaction;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_COMPACT);
+
+	begin_linked_list_compaction(&compaction, list);
+
+	LINKED_LIST_PROBE_RETURN(int, linked_list_compact_step(&compaction, (size_t)-1));
+
+}
+
+/*
+ * This function inserts a new cell after previous in the list of header.
+ * If previous is NULL, the cell is inserted at the top of the list.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+static int header_insert_after(LinkedListHeader *header, LinkedList *previous, void *data, void (*print_data)(void *data), void (*free_data)(void **data)) {
+
+	LinkedList **link = (NULL == previous) ? &(header->head) : &(previous->next);
+	LinkedList *cell;
+
+	cell = alloc_linked_list(data, print_data, free_data, *link);
+	if (NULL == cell)
+		return 0;
+
+	*link = cell;
+	if (previous == header->tail)
+		header->tail = cell;
+	header->size += 1;
+
+	return 1;
+
+}
+
+/*
+ * This function unlinks the cell after previous in the list of header.
+ * If previous is NULL, the first cell is unlinked.
+ * It returns the unlinked cell, whose 'next' field is the NULL pointer.
+ */
+static LinkedList * header_unlink_after(LinkedListHeader *header, LinkedList *previous) {
+
+	LinkedList **link = (NULL == previous) ? &(header->head) : &(previous->next);
+	LinkedList *cell = *link;
+
+	*link = cell->next;
+	if (cell == header->tail)
+		header->tail = previous;
+	header->size -= 1;
+	cell->next = NULL;
+
+	return cell;
+
+}
+
+/*
+ * This function search the first cell of list for which LINKED_LIST_COMPARE(cmp_data, reference, data) is 0.
+ * 'previous' receives the cell before it (NULL for the first cell).
+ * It returns 0 if reference has not been found.
+ * Else it returns 1.
+ */
+static int search_first_with_previous(LinkedList *list, void *reference, int (*cmp_data)(void *data1, void *data2), LinkedList **previous) {
+
+	LinkedList *before = NULL;
+
+	while (list != NULL && LINKED_LIST_COMPARE(cmp_data, reference, list->data) != 0) {
+		before = list;
+		list = list->next;
+	}
+
+	*previous = before;
+
+	return (list != NULL);
+
+}
+
+/*
+ * This function search the last cell of list for which LINKED_LIST_COMPARE(cmp_data, reference, data) is 0.
+ * 'previous' receives the cell before it (NULL for the first cell).
+ * It returns 0 if reference has not been found.
+ * Else it returns 1.
+ */
+static int search_last_with_previous(LinkedList *list, void *reference, int (*cmp_data)(void *data1, void *data2), LinkedList **previous) {
+
+	LinkedList *before = NULL;
+	int found = 0;
+
+	*previous = NULL;
+	while (list != NULL) {
+		if (LINKED_LIST_COMPARE(cmp_data, reference, list->data) == 0) {
+			*previous = before;
+			found = 1;
+		}
+		before = list;
+		list = list->next;
+	}
+
+	return found;
+
+}
+
+/*
+ * This function initializes header as an empty list.
+ */
+void init_linked_list_header(LinkedListHeader *header) {
+
+	header->head = NULL;
+	header->tail = NULL;
+	header->size = 0;
+
+}
+
+/*
+ * This function frees the LinkedList owned by header.
+ * At the end of the function, header is an empty list.
+ */
+void free_linked_list_header(LinkedListHeader *header) {
+
+	free_linked_list(&(header->head));
+	init_linked_list_header(header);
+
+}
+
+/*
+ * This function add to the top of the list the data in parameters, in O(1).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int header_add_to_top(LinkedListHeader *header, void *data, void (*print_data)(void *data), void (*free_data)(void **data)) {
+
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_TO_TOP);
+	LINKED_LIST_PROBE_RETURN(int, header_insert_after(header, NULL, data, print_data, free_data));
+
+}
+
+/*
+ * This function add at the end of the list the data in parameters, in O(1).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int header_add_at_the_end(LinkedListHeader *header, void *data, void (*print_data)(void *data), void (*free_data)(void **data)) {
+
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_AT_THE_END);
+	LINKED_LIST_PROBE_RETURN(int, header_insert_after(header, header->tail, data, print_data, free_data));
+
+}
+
+/*
+ * This function add after the first occurrence of reference in the list, the data in parameters.
+ * If reference is NULL, the data is added at the end of the list.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int header_add_after_first_occurrence(LinkedListHeader *header, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList *previous;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_AFTER_FIRST_OCCURRENCE);
+
+	if (NULL == reference)
+		LINKED_LIST_PROBE_RETURN(int, header_add_at_the_end(header, data, print_data, free_data));
+
+	if (!search_first_with_previous(header->head, reference, cmp_data, &previous)) {
+		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+		LINKED_LIST_PROBE_RETURN(int, 0);
+	}
+
+	LINKED_LIST_PROBE_RETURN(int, header_insert_after(header, (NULL == previous) ? header->head : previous->next, data, print_data, free_data));
+
+}
+
+/*
+ * This function add before the first occurrence of reference in the list, the data in parameters.
+ * If reference is NULL, the data is added at the end of the list.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int header_add_before_first_occurrence(LinkedListHeader *header, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList *previous;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_BEFORE_FIRST_OCCURRENCE);
+
+	if (NULL == reference)
+		LINKED_LIST_PROBE_RETURN(int, header_add_at_the_end(header, data, print_data, free_data));
+
+	if (!search_first_with_previous(header->head, reference, cmp_data, &previous)) {
+		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
+		LINKED_LIST_PROBE_RETURN(int, 0);
+	}
+
+	LINKED_LIST_PROBE_RETURN(int, header_insert_after(header, previous, data, print_data, free_data));
+
+}
+
+/*
+ * This function add after the last occurrence of reference in the list, the data in parameters.
+ * If reference is NULL, the data is added at the end of the list.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int header_add_after_last_occurrence(LinkedListHeader *header, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList *previous;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_AFTER_LAST_OCCURRENCE);
+
+	if (NULL == reference)
+		LINKED_LIST_PROBE_RETURN(int, header_add_at_the_end(header, data, print_data, free_data));
+
+	if (!search_last_with_previous(header->head, reference, cmp_data, &previous)) {
+		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+		LINKED_LIST_PROBE_RETURN(int, 0);
+	}
+
+	LINKED_LIST_PROBE_RETURN(int, header_insert_after(header, (NULL == previous) ? header->head : previous->next, data, print_data, free_data));
+
+}
+
+/*
+ * This function add before the last occurrence of reference in the list, the data in parameters.
+ * If reference is NULL, the data is added at the end of the list.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int header_add_before_last_occurrence(LinkedListHeader *header, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList *previous;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_ADD_BEFORE_LAST_OCCURRENCE);
+
+	if (NULL == reference)
+		LINKED_LIST_PROBE_RETURN(int, header_add_at_the_end(header, data, print_data, free_data));
+
+	if (!search_last_with_previous(header->head, reference, cmp_data, &previous)) {
+		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
+		LINKED_LIST_PROBE_RETURN(int, 0);
+	}
+
+	LINKED_LIST_PROBE_RETURN(int, header_insert_after(header, previous, data, print_data, free_data));
+
+}
+
+/*
+ * This function moves all the cells of header_to_add at the end of header, in O(1).
+ * At the end of the function, header_to_add is an empty list.
+ */
+void header_add_list(LinkedListHeader *header, LinkedListHeader *header_to_add) {
+
+	if (NULL == header_to_add->head)
+		return;
+
+	if (NULL == header->head)
+		header->head = header_to_add->head;
+	else
+		header->tail->next = header_to_add->head;
+	header->tail = header_to_add->tail;
+	header->size += header_to_add->size;
+
+	init_linked_list_header(header_to_add);
+
+}
+
+/*
+ * This function remove the first occurrence of target_data in the list.
+ * The cell is freed but not its data.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int header_remove_first_occurrence(LinkedListHeader *header, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList *extracted;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_REMOVE_FIRST_OCCURRENCE);
+
+	extracted = header_extract_first_occurrence(header, target_data, cmp_data);
+
+	if (NULL == extracted)
+		LINKED_LIST_PROBE_RETURN(int, 0);
+
+	free_cell(extracted);
+
+	LINKED_LIST_PROBE_RETURN(int, 1);
+
+}
+
+/*
+ * This function remove the last occurrence of target_data in the list.
+ * The cell is freed but not its data.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int header_remove_last_occurrence(LinkedListHeader *header, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList *extracted;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_REMOVE_LAST_OCCURRENCE);
+
+	extracted = header_extract_last_occurrence(header, target_data, cmp_data);
+
+	if (NULL == extracted)
+		LINKED_LIST_PROBE_RETURN(int, 0);
+
+	free_cell(extracted);
+
+	LINKED_LIST_PROBE_RETURN(int, 1);
+
+}
+
+/*
+ * This function remove all occurrences of target_data in the list, in one pass.
+ * The cells are freed but not their data.
+ * It returns the number of removed elements.
+ */
+size_t header_remove_all_occurrence(LinkedListHeader *header, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList *previous = NULL, *tmp = header->head;
+	size_t count = 0;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_REMOVE_ALL_OCCURRENCE);
+
+	while (tmp != NULL) {
+		if (LINKED_LIST_COMPARE(cmp_data, tmp->data, target_data) == 0) {
+			free_cell(header_unlink_after(header, previous));
+			count += 1;
+		} else {
+			previous = tmp;
+		}
+		tmp = (NULL == previous) ? header->head : previous->next;
+	}
+
+	LINKED_LIST_PROBE_RETURN(size_t, count);
+
+}
+
+/*
+ * This function extract the first occurrence of target_data in the list.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+LinkedList * header_extract_first_occurrence(LinkedListHeader *header, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList *previous = NULL, *tmp = header->head;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_EXTRACT_FIRST_OCCURRENCE);
+
+	while (tmp != NULL && LINKED_LIST_COMPARE(cmp_data, tmp->data, target_data) != 0) {
+		previous = tmp;
+		tmp = tmp->next;
+	}
+
+	if (NULL == tmp)
+		LINKED_LIST_PROBE_RETURN(LinkedList *, NULL);
+
+	LINKED_LIST_PROBE_RETURN(LinkedList *, header_unlink_after(header, previous));
+
+}
+
+/*
+ * This function extract the last occurrence of target_data in the list.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+LinkedList * header_extract_last_occurrence(LinkedListHeader *header, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	LinkedList *previous = NULL, *tmp = header->head, *last_previous = NULL;
+	int found = 0;
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_EXTRACT_LAST_OCCURRENCE);
+
+	while (tmp != NULL) {
+		if (LINKED_LIST_COMPARE(cmp_data, tmp->data, target_data) == 0) {
+			last_previous = previous;
+			found = 1;
+		}
+		previous = tmp;
+		tmp = tmp->next;
+	}
+
+	if (!found)
+		LINKED_LIST_PROBE_RETURN(LinkedList *, NULL);
+
+	LINKED_LIST_PROBE_RETURN(LinkedList *, header_unlink_after(header, last_previous));
+
+}
+
+/*
+ * This function moves all the cells of the list into a new block of contiguous cells, like linked_list_compact,
+ * and points tail to the new last cell.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int header_compact(LinkedListHeader *header) {
+
+	LINKED_LIST_PROBE_BEGIN(LINKED_LIST_OP_HEADER_COMPACT);
+
+	if (!linked_list_compact(&(header->head)))
+		LINKED_LIST_PROBE_RETURN(int, 0);
+
+	/* the first cell is the first of the new block, so the last one is found without traversal */
+	if (header->head != NULL)
+		header->tail = block_cell(CELL_SLAB(header->head), header->size - 1);
+
+	LINKED_LIST_PROBE_RETURN(int, 1);
+
+}
+
+/*
+ * This function returns the number of elements in the list, in O(1).
+ */
+size_t linked_list_header_size(const LinkedListHeader *header) {
+
+	return header->size;
+
+}
+
+struct _list_writer {
+	FILE *stream; /* stream where the buffer is flushed, or NULL to use fd */
+	int fd; /* file descriptor where the buffer is flushed if stream is NULL */
+	char *buffer; /* buffer where the data are formatted */
+	size_t size; /* size of buffer */
+	size_t used; /* number of bytes waiting in buffer */
+};
+/*
+ * Output of write_linked_list and fwrite_linked_list.
+ */
+
+/*
+ * This function writes 'length' bytes of bytes on the output of writer.
+ * It returns 0 if there were a writing problem.
+ * Else it returns 1.
+ */
+static int writer_output(struct _list_writer *writer, const char *bytes, size_t length) {
+
+	ssize_t written;
+
+	if (writer->stream != NULL)
+		return (fwrite(bytes, 1, length, writer->stream) == length);
+
+	while (length > 0) {
+		written = write(writer->fd, bytes, length);
+		if (written < 0) {
+			if (EINTR == errno)
+				continue;
+			return 0;
+		}
+		bytes += written;
+		length -= (size_t)written;
+	}
+
+	return 1;
+
+}
+
+/*
+ * This function flushes the buffer of writer.
+ * It returns 0 if there were a writing problem.
+ * Else it returns 1.
+ */
+static int writer_flush(struct _list_writer *writer) {
+
+	int ret = 1;
+
+	if (writer->used > 0)
+		ret = writer_output(writer, writer->buffer, writer->used);
+	writer->used = 0;
+
+	return ret;
+
+}
+
+/*
+ * This function appends 'length' bytes of bytes to the buffer of writer, flushing it when it is full.
+ * It returns 0 if there were a writing problem.
+ * Else it returns 1.
+ */
+static int writer_append(struct _list_writer *writer, const char *bytes, size_t length) {
+
+	if (writer->size - writer->used < length && !writer_flush(writer))
+		return 0;
+
+	if (length > writer->size)
+		return writer_output(writer, bytes, length);
+
+	memcpy(writer->buffer + writer->used, bytes, length);
+	writer->used += length;
+
+	return 1;
+
+}
+
+/*
+ * This function formats data with format_data at the end of the buffer of writer.
+ * If the data does not fit in the free space, the buffer is flushed,
+ * and if it does not fit in the whole buffer, a temporary buffer is allocated.
+ * It returns 0 if there were a formatting, allocation or writing problem.
+ * Else it returns 1.
+ */
+static int writer_format(struct _list_writer *writer, void *data, int (*format_data)(void *data, char *buffer, size_t size)) {
+
+	int length;
+	char *tmp;
+
+	length = format_data(data, writer->buffer + writer->used, writer->size - writer->used);
+	if (length < 0)
+		return 0;
+	if ((size_t)length < writer->size - writer->used) {
+		writer->used += (size_t)length;
+		return 1;
+	}
+
+	if (!writer_flush(writer))
+		return 0;
+
+	if ((size_t)length < writer->size) {
+		length = format_data(data, writer->buffer, writer->size);
+		if (length < 0 || (size_t)length >= writer->size)
+			return 0;
+		writer->used = (size_t)length;
+		return 1;
+	}
+
+	tmp = (char *)malloc((size_t)length + 1);
+	if (NULL == tmp) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return 0;
+	}
+	if (format_data(data, tmp, (size_t)length + 1) != length) {
+		free(tmp);
+		return 0;
+	}
+	length = writer_output(writer, tmp, (size_t)length);
+	free(tmp);
+
+	return length;
+
+}
+
+/*
+ * This function writes the LinkedList on the output of writer, then flushes it.
+ * It returns 0 if there were a problem.
+ * Else it returns 1.
+ */
+static int writer_write_list(struct _list_writer *writer, LinkedList *list, char *separator, int (*format_data)(void *data, char *buffer, size_t size)) {
+
+	size_t separator_length;
+	int ret = 1;
+
+	/* like print_linked_list_with_separator, a NULL separator is a space */
+	if (NULL == separator)
+		separator = " ";
+	separator_length = strlen(separator);
+
+	while (ret && list != NULL) {
+		ret = writer_format(writer, list->data, format_data);
+		if (ret && separator_length > 0 && list->next != NULL)
+			ret = writer_append(writer, separator, separator_length);
+		list = list->next;
+	}
+
+	if (ret)
+		ret = writer_append(writer, "\n", 1);
+	if (!writer_flush(writer))
+		ret = 0;
+
+	return ret;
+
+}
+
+/*
+ * This function allocates the buffer of writer and writes the LinkedList with it.
+ * It returns 0 if there were a problem.
+ * Else it returns 1.
+ */
+static int writer_run(struct _list_writer *writer, LinkedList *list, char *separator, size_t buffer_size, int (*format_data)(void *data, char *buffer, size_t size)) {
+
+	int ret;
+
+	writer->size = (0 == buffer_size) ? DEFAULT_WRITE_BUFFER_SIZE : buffer_size;
+	writer->used = 0;
+	writer->buffer = (char *)malloc(writer->size);
+	if (NULL == writer->buffer) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return 0;
+	}
+
+	ret = writer_write_list(writer, list, separator, format_data);
+
+	free(writer->buffer);
+
+	return ret;
+
+}
+
+/*
+ * This function writes the LinkedList on the file descriptor fd, through a buffer of buffer_size bytes.
+ * It returns 0 if there were a problem.
+ * Else it returns 1.
+ */
+int write_linked_list(LinkedList *list, int fd, char *separator, size_t buffer_size, int (*format_data)(void *data, char *buffer, size_t size)) {
+
+	struct _list_writer writer;
+
+	writer.stream = NULL;
+	writer.fd = fd;
+
+	return writer_run(&writer, list, separator, buffer_size, format_data);
+
+}
+
+/*
+ * This function writes the LinkedList on stream, through a buffer of buffer_size bytes.
+ * It returns 0 if there were a problem.
+ * Else it returns 1.
+ */
+int fwrite_linked_list(LinkedList *list, FILE *stream, char *separator, size_t buffer_size, int (*format_data)(void *data, char *buffer, size_t size)) {
+
+	struct _list_writer writer;
+
+	writer.stream = stream;
+	writer.fd = -1;
+
+	return writer_run(&writer, list, separator, buffer_size, format_data);
 
 }
@@ -1,6 +1,8 @@
 #ifndef HEADER_LINKED_LIST_H_
 #define HEADER_LINKED_LIST_H_
 
+#include <stddef.h>
+#include <stdio.h>
 
 struct _list {
 	void *data; /* data of the cell */
@@ -16,6 +18,96 @@ struct _list {
 
 typedef struct _list LinkedList;
 
+struct _list_header {
+	LinkedList *head; /* first cell of the list */
+	LinkedList *tail; /* last cell of the list */
+	size_t size; /* number of cells in the list */
+};
+/*
+ * Header of a LinkedList which keeps track of its last cell and of its number of cells.
+ * The cells are usual LinkedList cells, so 'head' can be given to every function which reads a LinkedList.
+ * WARNING: a LinkedList owned by a header must only be modified with the header_* functions.
+ */
+
+typedef struct _list_header LinkedListHeader;
+
+struct _linked_list_pool;
+/*
+ * Slab of LinkedList cells.
+ * The cells are handed out from large blocks allocated with posix_memalign(3),
+ * the freed cells are recycled, and all the blocks are released at once.
+ * The fields of this structure are private to linked_list.c.
+ */
+
+typedef struct _linked_list_pool LinkedListPool;
+
+struct _linked_list_compaction {
+	LinkedList **list; /* pointer to the LinkedList to compact */
+	LinkedList **link; /* link to the next cell to relocate, NULL when the compaction is done */
+};
+/*
+ * State of an incremental compaction of a LinkedList, see linked_list_compact_step.
+ */
+
+typedef struct _linked_list_compaction LinkedListCompaction;
+
+
+/*
+ * @Function create_linked_list_pool
+ * @Params
+ * 		unsigned int cells_per_block
+ * 		# number of cells in each block of the pool #
+ * 		# if it is 0, a default size is used #
+ * @Return LinkedListPool * # pointer to a new pool or NULL #
+ * @Description
+ * 		This function creates an empty pool of LinkedList cells.
+ * 		No block is allocated before the first cell is requested.
+ * 		It returns NULL if there were an allocation problem.
+ */
+extern LinkedListPool * create_linked_list_pool(unsigned int cells_per_block);
+
+/*
+ * @Function free_linked_list_pool
+ * @Params
+ * 		LinkedListPool **pool
+ * 		# pointer to the pool to free #
+ * @Return void
+ * @Description
+ * 		This function releases all the blocks of the pool, in O(blocks).
+ * 		Every LinkedList built with this pool is released at the same time,
+ * 		without calling free_data on its data.
+ * 		If the pool is the current pool of the calling thread, the thread goes back to malloc(3).
+ * 		At the end of the function, the pool points to the NULL pointer.
+ */
+extern void free_linked_list_pool(LinkedListPool **pool);
+
+/*
+ * @Function reset_linked_list_pool
+ * @Params
+ * 		LinkedListPool *pool
+ * 		# pool to reset #
+ * @Return void
+ * @Description
+ * 		This function gives back all the cells of the pool in O(1), but keeps its blocks
+ * 		so that the next lists are built without any call to malloc(3).
+ * 		Every LinkedList built with this pool becomes invalid, and free_data is not called on its data.
+ */
+extern void reset_linked_list_pool(LinkedListPool *pool);
+
+/*
+ * @Function use_linked_list_pool
+ * @Params
+ * 		LinkedListPool *pool
+ * 		# pool to use or NULL to go back to malloc(3) #
+ * @Return LinkedListPool * # pool previously used by the calling thread #
+ * @Description
+ * 		This function sets the pool used by the calling thread.
+ * 		While a pool is set, every function of this module takes its new cells from the pool.
+ * 		A freed cell goes back to where it comes from (its pool, its block or free(3)), whatever the pool set,
+ * 		so lists built with different pools, or without pool, can be mixed.
+ * 		WARNING: a pool is not thread-safe : it must be used, and its cells freed, by only one thread at a time.
+ */
+extern LinkedListPool * use_linked_list_pool(LinkedListPool *pool);
 
 /*
  * @Function free_linked_list
@@ -26,10 +118,23 @@ typedef struct _list LinkedList;
  * @Description
  * 		This function frees the memory space dedicated to the LinkedList in the parameters.
  * 		At the end of the function, the LinkedList points to the NULL pointer.
- * 		WARNING : the free_data function cannot be NULL (it is used to free the data from the structure).
+ * 		The data of a cell whose free_data is NULL are not freed (they still belong to the caller).
  */
 extern void free_linked_list(LinkedList **list);
 
+/*
+ * @Function free_linked_list_cell
+ * @Params
+ * 		LinkedList *cell
+ * 		# cell to free, or NULL #
+ * @Return void
+ * @Description
+ * 		This function frees one cell, without its data, for example a cell returned by extract_first_occurrence.
+ * 		The cell goes back to where it comes from : its pool, its block (see linked_list_from_array) or free(3).
+ * 		WARNING: a cell of this module must not be given to free(3), it may not come from malloc(3).
+ */
+extern void free_linked_list_cell(LinkedList *cell);
+
 /*
  * @Function print_linked_list
  * @Params
@@ -59,6 +164,57 @@ extern void print_linked_list(LinkedList *list);
  */
 extern void print_linked_list_with_separator(LinkedList *list, char *separator);
 
+/*
+ * @Function write_linked_list
+ * @Params
+ * 		LinkedList *list
+ * 		# LinkedList to write #
+ * 		int fd
+ * 		# file descriptor where the LinkedList is written #
+ * 		char *separator
+ * 		# string to separate the data, "" for none #
+ * 		# if NULL, the separator is a space #
+ * 		size_t buffer_size
+ * 		# size of the buffer where the data are formatted #
+ * 		# if it is 0, a default size is used #
+ * 		int (*format_data)(void *data, char *buffer, size_t size)
+ * 		# pointer to a function which formats data in buffer, like snprintf(3) #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function writes all the LinkedList on fd, followed by a new line, without recursion.
+ * 		The data are formatted with format_data into a buffer of buffer_size bytes,
+ * 		which is written with write(2) only when it is full, and once at the end.
+ * 		format_data writes at most size bytes in buffer and returns the number of bytes
+ * 		the data needs (the data fits if this number is less than size), or a negative value on error.
+ * 		If separator is NULL, the separator is a space, as in print_linked_list_with_separator.
+ * 		It returns 0 if there were an allocation, formatting or writing problem.
+ * 		Else it returns 1.
+ */
+extern int write_linked_list(LinkedList *list, int fd, char *separator, size_t buffer_size, int (*format_data)(void *data, char *buffer, size_t size));
+
+/*
+ * @Function fwrite_linked_list
+ * @Params
+ * 		LinkedList *list
+ * 		# LinkedList to write #
+ * 		FILE *stream
+ * 		# stream where the LinkedList is written #
+ * 		char *separator
+ * 		# string to separate the data, "" for none #
+ * 		# if NULL, the separator is a space #
+ * 		size_t buffer_size
+ * 		# size of the buffer where the data are formatted #
+ * 		# if it is 0, a default size is used #
+ * 		int (*format_data)(void *data, char *buffer, size_t size)
+ * 		# pointer to a function which formats data in buffer, like snprintf(3) #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function is write_linked_list for a stream: the buffer is written with fwrite(3).
+ * 		It returns 0 if there were an allocation, formatting or writing problem.
+ * 		Else it returns 1.
+ */
+extern int fwrite_linked_list(LinkedList *list, FILE *stream, char *separator, size_t buffer_size, int (*format_data)(void *data, char *buffer, size_t size));
+
 /*
  * @Function add_to_top
  * @Params
@@ -199,6 +355,229 @@ extern int add_after_last_occurrence(LinkedList **list, void *data, void (*print
  */
 extern int add_before_last_occurrence(LinkedList **list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2));
 
+/*
+ * @Function add_array_after_first_occurrence
+ * @Params
+ * 		LinkedList **list
+ * 		# LinkedList which will be modified #
+ * 		void **array
+ * 		# data to add, in order #
+ * 		size_t size
+ * 		# number of data in array #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * 		void *reference
+ * 		# data reference to add the data after it #
+ * 		# if it is NULL, the data are added at the end #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add after the first occurrence of reference in the LinkedList, the size data of array, in their order.
+ * 		The list is traversed once, and the cells are allocated in one block, like linked_list_from_array.
+ * 		WARNING: We suppose that cmp_data can compare all the data of the LinkedList.
+ * 		It returns 0 if there were an allocation problem or reference not found, and list is not modified.
+ * 		Else it returns 1.
+ */
+extern int add_array_after_first_occurrence(LinkedList **list, void **array, size_t size, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function add_array_after_last_occurrence
+ * @Params
+ * 		LinkedList **list
+ * 		# LinkedList which will be modified #
+ * 		void **array
+ * 		# data to add, in order #
+ * 		size_t size
+ * 		# number of data in array #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * 		void *reference
+ * 		# data reference to add the data after it #
+ * 		# if it is NULL, the data are added at the end #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add after the last occurrence of reference in the LinkedList, the size data of array, in their order.
+ * 		The list is traversed once, and the cells are allocated in one block, like linked_list_from_array.
+ * 		WARNING: We suppose that cmp_data can compare all the data of the LinkedList.
+ * 		It returns 0 if there were an allocation problem or reference not found, and list is not modified.
+ * 		Else it returns 1.
+ */
+extern int add_array_after_last_occurrence(LinkedList **list, void **array, size_t size, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function add_array_before_first_occurrence
+ * @Params
+ * 		LinkedList **list
+ * 		# LinkedList which will be modified #
+ * 		void **array
+ * 		# data to add, in order #
+ * 		size_t size
+ * 		# number of data in array #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * 		void *reference
+ * 		# data reference to add the data before it #
+ * 		# if it is NULL, the data are added at the end #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add before the first occurrence of reference in the LinkedList, the size data of array, in their order.
+ * 		The list is traversed once, and the cells are allocated in one block, like linked_list_from_array.
+ * 		WARNING: We suppose that cmp_data can compare all the data of the LinkedList.
+ * 		It returns 0 if there were an allocation problem or reference not found, and list is not modified.
+ * 		Else it returns 1.
+ */
+extern int add_array_before_first_occurrence(LinkedList **list, void **array, size_t size, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function add_array_before_last_occurrence
+ * @Params
+ * 		LinkedList **list
+ * 		# LinkedList which will be modified #
+ * 		void **array
+ * 		# data to add, in order #
+ * 		size_t size
+ * 		# number of data in array #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * 		void *reference
+ * 		# data reference to add the data before it #
+ * 		# if it is NULL, the data are added at the end #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add before the last occurrence of reference in the LinkedList, the size data of array, in their order.
+ * 		The list is traversed once, and the cells are allocated in one block, like linked_list_from_array.
+ * 		WARNING: We suppose that cmp_data can compare all the data of the LinkedList.
+ * 		It returns 0 if there were an allocation problem or reference not found, and list is not modified.
+ * 		Else it returns 1.
+ */
+extern int add_array_before_last_occurrence(LinkedList **list, void **array, size_t size, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function add_chain_after_first_occurrence
+ * @Params
+ * 		LinkedList **list
+ * 		# LinkedList which will be modified #
+ * 		LinkedList *chain
+ * 		# LinkedList to insert, whose cells are linked in list #
+ * 		void *reference
+ * 		# data reference to add the chain after it #
+ * 		# if it is NULL, the chain is added at the end #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function links the cells of chain after the first occurrence of reference in the LinkedList, without copying them.
+ * 		The list is traversed once, and chain once to find its last cell.
+ * 		WARNING: We suppose that cmp_data can compare all the data of the LinkedList.
+ * 		It returns 0 if reference has not been found, and chain is not linked.
+ * 		Else it returns 1.
+ */
+extern int add_chain_after_first_occurrence(LinkedList **list, LinkedList *chain, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function add_chain_after_last_occurrence
+ * @Params
+ * 		LinkedList **list
+ * 		# LinkedList which will be modified #
+ * 		LinkedList *chain
+ * 		# LinkedList to insert, whose cells are linked in list #
+ * 		void *reference
+ * 		# data reference to add the chain after it #
+ * 		# if it is NULL, the chain is added at the end #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function links the cells of chain after the last occurrence of reference in the LinkedList, without copying them.
+ * 		The list is traversed once, and chain once to find its last cell.
+ * 		WARNING: We suppose that cmp_data can compare all the data of the LinkedList.
+ * 		It returns 0 if reference has not been found, and chain is not linked.
+ * 		Else it returns 1.
+ */
+extern int add_chain_after_last_occurrence(LinkedList **list, LinkedList *chain, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function add_chain_before_first_occurrence
+ * @Params
+ * 		LinkedList **list
+ * 		# LinkedList which will be modified #
+ * 		LinkedList *chain
+ * 		# LinkedList to insert, whose cells are linked in list #
+ * 		void *reference
+ * 		# data reference to add the chain before it #
+ * 		# if it is NULL, the chain is added at the end #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function links the cells of chain before the first occurrence of reference in the LinkedList, without copying them.
+ * 		The list is traversed once, and chain once to find its last cell.
+ * 		WARNING: We suppose that cmp_data can compare all the data of the LinkedList.
+ * 		It returns 0 if reference has not been found, and chain is not linked.
+ * 		Else it returns 1.
+ */
+extern int add_chain_before_first_occurrence(LinkedList **list, LinkedList *chain, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function add_chain_before_last_occurrence
+ * @Params
+ * 		LinkedList **list
+ * 		# LinkedList which will be modified #
+ * 		LinkedList *chain
+ * 		# LinkedList to insert, whose cells are linked in list #
+ * 		void *reference
+ * 		# data reference to add the chain before it #
+ * 		# if it is NULL, the chain is added at the end #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function links the cells of chain before the last occurrence of reference in the LinkedList, without copying them.
+ * 		The list is traversed once, and chain once to find its last cell.
+ * 		WARNING: We suppose that cmp_data can compare all the data of the LinkedList.
+ * 		It returns 0 if reference has not been found, and chain is not linked.
+ * 		Else it returns 1.
+ */
+extern int add_chain_before_last_occurrence(LinkedList **list, LinkedList *chain, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function add_sorted
+ * @Params
+ * 		LinkedList **list
+ * 		# LinkedList sorted by cmp_data which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add the data in parameters in list, so that list stays sorted by cmp_data.
+ * 		The data is added after the data equal to it.
+ * 		WARNING: We suppose that list is sorted by cmp_data, and that cmp_data can compare all the data of the LinkedList.
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int add_sorted(LinkedList **list, void *data, void (*print_data)(void *data), void (*free_data)(void **data), int (*cmp_data)(void *data1, void *data2));
+
 /*
  * @Function add_list
  * @Params
@@ -213,9 +592,117 @@ extern int add_before_last_occurrence(LinkedList **list, void *data, void (*prin
  * 		WARNING: This function just link list_to_add at the end of list,
  * 		so if you free(or modifies) list_to_add, list will be modified.
  * 		And if you free(or modifies) an element of list which is in list_to_add, list_to_add will be modified.
+ * 		The PersistentList of persistent_list.h shares cells between lists safely.
  */
 extern void add_list(LinkedList **list, const LinkedList *list_to_add);
 
+/*
+ * @Function splice_linked_list
+ * @Params
+ * 		LinkedList **link
+ * 		# link to the first cell of the range to move #
+ * 		# the LinkedList itself or the field 'next' of the cell before the range #
+ * 		LinkedList *last
+ * 		# last cell of the range to move #
+ * 		LinkedList **destination
+ * 		# link where the range is inserted #
+ * 		# a LinkedList, or the field 'next' of the cell after which the range is inserted #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function moves the cells from *link to last into destination, in O(1), without copying them.
+ * 		The cells after last stay in the first list, in place of the range.
+ * 		The range can be moved to another LinkedList or to another place of the same LinkedList.
+ * 		WARNING : last must be reachable from *link, and destination must not be inside the range.
+ * 		It returns 0 if the range is empty (*link or last is NULL), and nothing is moved.
+ * 		Else it returns 1.
+ */
+extern int splice_linked_list(LinkedList **link, LinkedList *last, LinkedList **destination);
+
+/*
+ * @Function split_linked_list_at
+ * @Params
+ * 		LinkedList **list
+ * 		# pointer to the LinkedList to split #
+ * 		size_t position
+ * 		# number of cells kept in list #
+ * @Return LinkedList * # cells after the first position cells #
+ * @Description
+ * 		This function cuts list after its first position cells, without copying them.
+ * 		It returns the cells after the cut, or NULL if list has at most position cells.
+ * 		If position is 0, it returns all the list and list points to the NULL pointer.
+ */
+extern LinkedList * split_linked_list_at(LinkedList **list, size_t position);
+
+/*
+ * @Function split_linked_list_at_first_occurrence
+ * @Params
+ * 		LinkedList **list
+ * 		# pointer to the LinkedList to split #
+ * 		void *target_data
+ * 		# data where list is cut #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare data #
+ * @Return LinkedList * # cells from the first occurrence of target_data #
+ * @Description
+ * 		This function cuts list before the first occurrence of target_data, without copying the cells.
+ * 		It returns the cells from this occurrence to the end, and list keeps the cells before it.
+ * 		If target_data is not present in list, it returns NULL and list is not modified.
+ */
+extern LinkedList * split_linked_list_at_first_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function split_linked_list_in_parts
+ * @Params
+ * 		LinkedList **list
+ * 		# pointer to the LinkedList to split #
+ * 		LinkedList **parts
+ * 		# array of count LinkedList which receives the parts #
+ * 		size_t count
+ * 		# number of parts #
+ * @Return size_t # number of cells of list #
+ * @Description
+ * 		This function cuts list into count consecutive parts, in order, whose sizes differ by at most one cell.
+ * 		The cells are not copied : one walk counts them, and one walk cuts the parts.
+ * 		When list has less than count cells, the last parts are NULL.
+ * 		At the end of the function, list points to the NULL pointer.
+ * 		If count is 0, list is not modified.
+ * 		It returns the number of cells of list.
+ */
+extern size_t split_linked_list_in_parts(LinkedList **list, LinkedList **parts, size_t count);
+
+/*
+ * @Function merge_linked_list
+ * @Params
+ * 		LinkedList **list
+ * 		# LinkedList sorted by cmp_data which will be modified #
+ * 		LinkedList *list_to_merge
+ * 		# LinkedList sorted by cmp_data to merge into list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return void
+ * @Description
+ * 		This function merges the cells of list_to_merge into list, in one pass, so that list stays sorted.
+ * 		For equal data, the cells of list come first.
+ * 		No cell is allocated : at the end of the function, list_to_merge is a part of list.
+ * 		WARNING: We suppose that both lists are sorted by cmp_data.
+ */
+extern void merge_linked_list(LinkedList **list, LinkedList *list_to_merge, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function sort_linked_list
+ * @Params
+ * 		LinkedList **list
+ * 		# LinkedList which will be sorted #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return void
+ * @Description
+ * 		This function sorts list in increasing order of cmp_data, by relinking its cells.
+ * 		It is a stable bottom-up merge sort : O(n log n), without recursion nor allocation.
+ * 		WARNING: We suppose that cmp_data can compare all the data of the LinkedList.
+ */
+extern void sort_linked_list(LinkedList **list, int (*cmp_data)(void *data1, void *data2));
+
 /*
  * @Function remove_first_occurrence
  * @Params
@@ -263,11 +750,44 @@ extern int remove_last_occurrence(LinkedList **list, void *target_data, int (*cm
  * 		# pointer to a function that can compare the elements of list #
  * @Return void
  * @Description
- * 		This function remove all occurrences of target_data in list.
+ * 		This function remove all occurrences of target_data in list, in one pass.
  * 		WARNING: We suppose that cmp_data can compare all the elements of list.
  */
 extern void remove_all_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2));
 
+/*
+ * @Function remove_if
+ * @Params
+ * 		LinkedList **list
+ * 		# LinkedList which will be modified #
+ * 		int (*predicate)(void *data, void *context)
+ * 		# pointer to a function which returns a non zero value for the data to remove #
+ * 		void *context
+ * 		# pointer given to each call of predicate #
+ * @Return size_t # number of removed elements #
+ * @Description
+ * 		This function remove from list all the cells whose data verify predicate, in one pass.
+ * 		Unlike remove_all_occurrence, the data of the removed cells are freed with their free_data.
+ */
+extern size_t remove_if(LinkedList **list, int (*predicate)(void *data, void *context), void *context);
+
+/*
+ * @Function filter_linked_list
+ * @Params
+ * 		LinkedList **list
+ * 		# LinkedList which will be modified #
+ * 		int (*predicate)(void *data, void *context)
+ * 		# pointer to a function which returns a non zero value for the data to keep #
+ * 		void *context
+ * 		# pointer given to each call of predicate #
+ * @Return LinkedList * # LinkedList of the removed cells #
+ * @Description
+ * 		This function keeps in list only the cells whose data verify predicate, in one pass.
+ * 		The other cells are not freed : they are returned as a LinkedList, in their order,
+ * 		so that they can be disposed of at once with free_linked_list.
+ */
+extern LinkedList * filter_linked_list(LinkedList **list, int (*predicate)(void *data, void *context), void *context);
+
 /*
  * @Function extract_first_occurrence
  * @Params
@@ -282,6 +802,7 @@ extern void remove_all_occurrence(LinkedList **list, void *target_data, int (*cm
  * 		This function remove the first occurrence of target_data in list.
  * 		It returns a LinkedList corresponding to where the function found target_data in list.
  * 		If target_data is not present in list, it returns NULL.
+ * 		The returned cell is released with free_linked_list_cell, or free_linked_list.
  * 		WARNING: We suppose that cmp_data can compare all the elements of list.
  */
 extern LinkedList * extract_first_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2));
@@ -300,6 +821,7 @@ extern LinkedList * extract_first_occurrence(LinkedList **list, void *target_dat
  * 		This function remove the last occurrence of target_data in list.
  * 		It returns a LinkedList corresponding to where the function found target_data in list.
  * 		If target_data is not present in list, it returns NULL.
+ * 		The returned cell is released with free_linked_list_cell, or free_linked_list.
  * 		WARNING: We suppose that cmp_data can compare all the elements of list.
  */
 extern LinkedList * extract_last_occurrence(LinkedList **list, void *target_data, int (*cmp_data)(void *data1, void *data2));
@@ -340,6 +862,36 @@ extern LinkedList * find_first_occurrence(LinkedList *list, void *target_data, i
  */
 extern LinkedList * find_last_occurrence(LinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
 
+/*
+ * @Function find_occurrences
+ * @Params
+ * 		LinkedList *list
+ * 		# LinkedList where the targets are searched #
+ * 		void **targets
+ * 		# data to find #
+ * 		size_t count
+ * 		# number of data in targets #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		unsigned long (*hash_data)(void *data)
+ * 		# pointer to a function which hashes a data, or NULL #
+ * 		# two equal data must have the same hash #
+ * 		LinkedList **first
+ * 		# array of count cells which receives the first occurrence of each target, or NULL #
+ * 		LinkedList **last
+ * 		# array of count cells which receives the last occurrence of each target, or NULL #
+ * @Return size_t # number of targets found #
+ * @Description
+ * 		This function searches all the targets in one traversal of list.
+ * 		first[i] (and last[i]) receives the first (and the last) cell of list whose data is equal to targets[i],
+ * 		or NULL if targets[i] is not present in list.
+ * 		If hash_data is not NULL and there are more than a few targets, the targets are put in a temporary hash set,
+ * 		so the search costs O(n + count) instead of O(n * count).
+ * 		If last is NULL, the traversal stops when all the targets have been found.
+ * 		It returns the number of targets found (0 if first and last are both NULL).
+ */
+extern size_t find_occurrences(LinkedList *list, void **targets, size_t count, int (*cmp_data)(void *data1, void *data2), unsigned long (*hash_data)(void *data), LinkedList **first, LinkedList **last);
+
 /*
  * @Function linked_list_size
  * @Params
@@ -352,5 +904,403 @@ extern LinkedList * find_last_occurrence(LinkedList *list, void *target_data, in
  */
 extern unsigned int linked_list_size(LinkedList *list);
 
+/*
+ * @Function linked_list_from_array
+ * @Params
+ * 		LinkedList **list
+ * 		# pointer to a LinkedList #
+ * 		void **array
+ * 		# data to add, in order #
+ * 		size_t size
+ * 		# number of data in array #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function adds to the top of the LinkedList the size data of array, in the order of array.
+ * 		All the cells are allocated with one call to posix_memalign(3), contiguous and in the order of the list
+ * 		(with a header of a few bytes every 64 KiB), so the traversal reads the memory sequentially.
+ * 		The cells are freed one by one like the other cells (free_linked_list, remove_* ...),
+ * 		and the block is released when its last cell is freed.
+ * 		A cell finds its block from its address : freeing it takes no lock, even from another thread.
+ * 		It returns 0 if there were an allocation problem, and list is not modified.
+ * 		Else it returns 1.
+ */
+extern int linked_list_from_array(LinkedList **list, void **array, size_t size, void (*print_data)(void *data), void (*free_data)(void **data));
+
+/*
+ * @Function linked_list_to_array
+ * @Params
+ * 		LinkedList *list
+ * 		# LinkedList to copy #
+ * 		void **array
+ * 		# array where the data are written #
+ * 		size_t size
+ * 		# number of elements of array #
+ * @Return size_t # number of data written in array #
+ * @Description
+ * 		This function writes the data of list in array, in the order of the list, in one pass.
+ * 		It stops at the end of the list or when array is full.
+ * 		It returns the number of data written.
+ */
+extern size_t linked_list_to_array(LinkedList *list, void **array, size_t size);
+
+/*
+ * @Function linked_list_compact
+ * @Params
+ * 		LinkedList **list
+ * 		# pointer to the LinkedList to compact #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function moves all the cells of list into one new block of contiguous cells, in the order of the list,
+ * 		so the traversal reads the memory sequentially, and frees the old cells (not their data), in O(n).
+ * 		The data and the order of the list do not change, but the addresses of the cells do.
+ * 		The new cells are freed like the cells of linked_list_from_array.
+ * 		WARNING : the cells leave their pool, a list compacted must not be released with free_linked_list_pool.
+ * 		WARNING : the pointers to the old cells kept outside of the list become invalid, so a list owned by
+ * 		a LinkedListHeader (use header_compact), an IndexedLinkedList or a LinkedListCursor must not be compacted.
+ * 		It returns 0 if there were an allocation problem, and list is not modified.
+ * 		Else it returns 1.
+ */
+extern int linked_list_compact(LinkedList **list);
+
+/*
+ * @Function begin_linked_list_compaction
+ * @Params
+ * 		LinkedListCompaction *compaction
+ * 		# state of the compaction #
+ * 		LinkedList **list
+ * 		# pointer to the LinkedList to compact #
+ * @Return void
+ * @Description
+ * 		This function prepares the incremental compaction of list, done by linked_list_compact_step.
+ */
+extern void begin_linked_list_compaction(LinkedListCompaction *compaction, LinkedList **list);
+
+/*
+ * @Function linked_list_compact_step
+ * @Params
+ * 		LinkedListCompaction *compaction
+ * 		# state of the compaction #
+ * 		size_t max_cells
+ * 		# maximum number of cells to relocate #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function moves the next max_cells cells of the list (or less at its end) into one new block,
+ * 		like linked_list_compact, so a long list can be compacted in several short steps.
+ * 		The compaction keeps a link into the last relocated cell : this cell must not be removed between two steps,
+ * 		unless the list is emptied (the compaction is then done).
+ * 		The cells added after this cell between two steps are relocated by the next steps, the ones added before are not.
+ * 		WARNING : the cells leave their pool, a list compacted must not be released with free_linked_list_pool.
+ * 		WARNING : the pointers to the old cells kept outside of the list become invalid, so a list owned by
+ * 		a LinkedListHeader, an IndexedLinkedList or a LinkedListCursor must not be compacted.
+ * 		It returns 0 if there were an allocation problem, and the step can be retried.
+ * 		Else it returns 1.
+ */
+extern int linked_list_compact_step(LinkedListCompaction *compaction, size_t max_cells);
+
+/*
+ * @Function linked_list_compaction_done
+ * @Params
+ * 		const LinkedListCompaction *compaction
+ * 		# state of the compaction #
+ * @Return int # 1 if the compaction is done, else 0 #
+ * @Description
+ * 		This function tells if all the cells of the list have been relocated.
+ */
+extern int linked_list_compaction_done(const LinkedListCompaction *compaction);
+
+
+/*
+ * @Function init_linked_list_header
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header to initialize #
+ * @Return void
+ * @Description
+ * 		This function initializes header as an empty list.
+ */
+extern void init_linked_list_header(LinkedListHeader *header);
+
+/*
+ * @Function free_linked_list_header
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList to free #
+ * @Return void
+ * @Description
+ * 		This function frees the LinkedList owned by header, like free_linked_list.
+ * 		At the end of the function, header is an empty list.
+ * 		The data of a cell whose free_data is NULL are not freed (they still belong to the caller).
+ */
+extern void free_linked_list_header(LinkedListHeader *header);
+
+/*
+ * @Function header_add_to_top
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add to the top of the LinkedList the data in parameters, in O(1).
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int header_add_to_top(LinkedListHeader *header, void *data, void (*print_data)(void *data), void (*free_data)(void **data));
+
+/*
+ * @Function header_add_at_the_end
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add at the end of the LinkedList the data in parameters, in O(1).
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int header_add_at_the_end(LinkedListHeader *header, void *data, void (*print_data)(void *data), void (*free_data)(void **data));
+
+/*
+ * @Function header_add_after_first_occurrence
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * 		void *reference
+ * 		# data reference to add data after it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function is add_after_first_occurrence for a LinkedListHeader.
+ * 		WARNING: We suppose that cmp_data can compare all the data of the LinkedList.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int header_add_after_first_occurrence(LinkedListHeader *header, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function header_add_before_first_occurrence
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * 		void *reference
+ * 		# data reference to add data before it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function is add_before_first_occurrence for a LinkedListHeader.
+ * 		WARNING: We suppose that cmp_data can compare all the data of the LinkedList.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int header_add_before_first_occurrence(LinkedListHeader *header, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function header_add_after_last_occurrence
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * 		void *reference
+ * 		# data reference to add data after it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function is add_after_last_occurrence for a LinkedListHeader.
+ * 		WARNING: We suppose that cmp_data can compare all the data of the LinkedList.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int header_add_after_last_occurrence(LinkedListHeader *header, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function header_add_before_last_occurrence
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * 		void *reference
+ * 		# data reference to add data before it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function is add_before_last_occurrence for a LinkedListHeader.
+ * 		WARNING: We suppose that cmp_data can compare all the data of the LinkedList.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int header_add_before_last_occurrence(LinkedListHeader *header, void *data, void (*print_data)(void *data), void (*free_data)(void **data), void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function header_add_list
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList which will be modified #
+ * 		LinkedListHeader *header_to_add
+ * 		# header of the LinkedList to add to header #
+ * @Return void
+ * @Description
+ * 		This function moves all the cells of header_to_add at the end of header, in O(1).
+ * 		At the end of the function, header_to_add is an empty list,
+ * 		so that the cells are never shared between two headers.
+ */
+extern void header_add_list(LinkedListHeader *header, LinkedListHeader *header_to_add);
+
+/*
+ * @Function header_remove_first_occurrence
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to remove of the list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function that can compare the elements of the list #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function remove the first occurrence of target_data in the list.
+ * 		Like remove_first_occurrence, the cell is freed but not its data.
+ * 		WARNING: We suppose that cmp_data can compare all the elements of the list.
+ * 		If target_data has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int header_remove_first_occurrence(LinkedListHeader *header, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function header_remove_last_occurrence
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to remove of the list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function that can compare the elements of the list #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function remove the last occurrence of target_data in the list.
+ * 		Like remove_last_occurrence, the cell is freed but not its data.
+ * 		WARNING: We suppose that cmp_data can compare all the elements of the list.
+ * 		If target_data has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int header_remove_last_occurrence(LinkedListHeader *header, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function header_remove_all_occurrence
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to remove of the list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function that can compare the elements of the list #
+ * @Return size_t # number of removed elements #
+ * @Description
+ * 		This function remove all occurrences of target_data in the list, in one pass.
+ * 		WARNING: We suppose that cmp_data can compare all the elements of the list.
+ */
+extern size_t header_remove_all_occurrence(LinkedListHeader *header, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function header_extract_first_occurrence
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to extract of the list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function that can compare the elements of the list #
+ * @Return LinkedList * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function remove the first occurrence of target_data in the list, and returns its cell.
+ * 		The 'next' field of the returned cell is the NULL pointer.
+ * 		If target_data is not present in the list, it returns NULL.
+ * 		The returned cell is released with free_linked_list_cell, or free_linked_list.
+ * 		WARNING: We suppose that cmp_data can compare all the elements of the list.
+ */
+extern LinkedList * header_extract_first_occurrence(LinkedListHeader *header, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function header_extract_last_occurrence
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to extract of the list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function that can compare the elements of the list #
+ * @Return LinkedList * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function remove the last occurrence of target_data in the list, and returns its cell.
+ * 		The 'next' field of the returned cell is the NULL pointer.
+ * 		If target_data is not present in the list, it returns NULL.
+ * 		The returned cell is released with free_linked_list_cell, or free_linked_list.
+ * 		WARNING: We suppose that cmp_data can compare all the elements of the list.
+ */
+extern LinkedList * header_extract_last_occurrence(LinkedListHeader *header, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function header_compact
+ * @Params
+ * 		LinkedListHeader *header
+ * 		# header of the LinkedList to compact #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function is linked_list_compact for a LinkedListHeader : tail points to the new last cell.
+ * 		It returns 0 if there were an allocation problem, and the list is not modified.
+ * 		Else it returns 1.
+ */
+extern int header_compact(LinkedListHeader *header);
+
+/*
+ * @Function linked_list_header_size
+ * @Params
+ * 		const LinkedListHeader *header
+ * 		# header of the LinkedList to measured #
+ * @Return size_t # number of elements in the LinkedList #
+ * @Description
+ * 		This function returns the number of elements in the list, in O(1).
+ */
+extern size_t linked_list_header_size(const LinkedListHeader *header);
+
 
 #endif /* HEADER_LINKED_LIST_H_ */
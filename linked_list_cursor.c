@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "linked_list_cursor.h"
+
+
+#if defined(__GNUC__)
+#define PREFETCH(address) __builtin_prefetch(address)
+#else
+#define PREFETCH(address) ((void)(address))
+#endif
+
+/*
+ * This function moves the prefetched cell one cell further, when the cursor moves one cell further.
+ */
+static void advance_ahead(LinkedListCursor *cursor) {
+
+#if LINKED_LIST_PREFETCH_DISTANCE > 0
+	if (cursor->ahead != NULL) {
+		cursor->ahead = cursor->ahead->next;
+		if (cursor->ahead != NULL)
+			PREFETCH(cursor->ahead);
+	}
+#else
+	(void)cursor;
+#endif
+
+}
+
+/*
+ * This function puts the cursor on the first cell of the list, and returns it.
+ */
+LinkedList * linked_list_cursor_begin(LinkedListCursor *cursor, LinkedList **list) {
+
+	int i;
+
+	cursor->link = list;
+	cursor->ahead = *list;
+	for (i = 0; i < LINKED_LIST_PREFETCH_DISTANCE && cursor->ahead != NULL; i++) {
+		cursor->ahead = cursor->ahead->next;
+		if (cursor->ahead != NULL)
+			PREFETCH(cursor->ahead);
+	}
+
+	return *list;
+
+}
+
+/*
+ * This function returns the cell of the cursor, or NULL if the cursor is at the end.
+ */
+LinkedList * linked_list_cursor_peek(LinkedListCursor *cursor) {
+
+	return *(cursor->link);
+
+}
+
+/*
+ * This function moves the cursor to the following cell, and returns it.
+ */
+LinkedList * linked_list_cursor_next(LinkedListCursor *cursor) {
+
+	if (NULL == *(cursor->link))
+		return NULL;
+
+	cursor->link = &((*(cursor->link))->next);
+	advance_ahead(cursor);
+
+	return *(cursor->link);
+
+}
+
+/*
+ * This function puts in data the data of the current cell and of the n - 1 following ones,
+ * then moves the cursor after them.
+ * It returns the number of data put in the array.
+ */
+size_t linked_list_cursor_next_n(LinkedListCursor *cursor, void **data, size_t n) {
+
+	LinkedList *cell = *(cursor->link);
+	size_t count = 0;
+
+	while (count < n && cell != NULL) {
+		/* the data are used after the whole batch is read : they can be loaded meanwhile */
+		PREFETCH(cell->data);
+		data[count++] = cell->data;
+		cursor->link = &(cell->next);
+		advance_ahead(cursor);
+		cell = cell->next;
+	}
+
+	return count;
+
+}
+
+/*
+ * This function removes the current cell from the list in O(1), and moves the cursor to the following cell.
+ * The cell is freed but not its data.
+ */
+LinkedList * linked_list_cursor_erase(LinkedListCursor *cursor) {
+
+	LinkedList *cell = *(cursor->link);
+
+	if (NULL == cell)
+		return NULL;
+
+	*(cursor->link) = cell->next;
+	advance_ahead(cursor);
+
+	free_linked_list_cell(cell);
+
+	return *(cursor->link);
+
+}
+
+/*
+ * This function add the data in parameters before the current cell in O(1).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int linked_list_cursor_insert(LinkedListCursor *cursor, void *data, void (*print_data)(void *data), void (*free_data)(void **data)) {
+
+	LinkedList *cell = *(cursor->link);
+
+	/* add_to_top leaves NULL in the link when the allocation fails */
+	if (!add_to_top(cursor->link, data, print_data, free_data)) {
+		*(cursor->link) = cell;
+		return 0;
+	}
+
+	cursor->link = &((*(cursor->link))->next);
+
+	return 1;
+
+}
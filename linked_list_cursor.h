@@ -0,0 +1,120 @@
+#ifndef HEADER_LINKED_LIST_CURSOR_H_
+#define HEADER_LINKED_LIST_CURSOR_H_
+
+#include <stddef.h>
+#include "linked_list.h"
+
+
+#ifndef LINKED_LIST_PREFETCH_DISTANCE
+#define LINKED_LIST_PREFETCH_DISTANCE 4
+#endif
+/*
+ * Number of cells between the current cell of a cursor and the cell which is prefetched.
+ * 0 disables the prefetch.
+ */
+
+struct _linked_list_cursor {
+	LinkedList **link; /* pointer to the link to the current cell : the head of the list or the 'next' field of the previous cell */
+	LinkedList *ahead; /* cell LINKED_LIST_PREFETCH_DISTANCE cells after the current one, or NULL */
+};
+/*
+ * Position in a LinkedList, on a cell or at the end of the list.
+ * Because the cursor keeps the link to its cell, the cell can be erased and a cell can be inserted before it in O(1).
+ * While moving, the cursor asks the processor to load the cell LINKED_LIST_PREFETCH_DISTANCE cells ahead,
+ * so the cells are already in cache when they are reached.
+ * A cursor is invalid once the list is modified by anything else than the cursor itself.
+ */
+
+typedef struct _linked_list_cursor LinkedListCursor;
+
+
+/*
+ * @Function linked_list_cursor_begin
+ * @Params
+ * 		LinkedListCursor *cursor
+ * 		# cursor to initialize #
+ * 		LinkedList **list
+ * 		# pointer to the LinkedList to traverse #
+ * @Return LinkedList * # first cell of the list or NULL #
+ * @Description
+ * 		This function puts the cursor on the first cell of the list, and returns it.
+ * 		If the list is empty, the cursor is at the end and it returns NULL.
+ */
+extern LinkedList * linked_list_cursor_begin(LinkedListCursor *cursor, LinkedList **list);
+
+/*
+ * @Function linked_list_cursor_peek
+ * @Params
+ * 		LinkedListCursor *cursor
+ * 		# cursor to read #
+ * @Return LinkedList * # current cell or NULL #
+ * @Description
+ * 		This function returns the cell of the cursor without moving it, or NULL if the cursor is at the end.
+ */
+extern LinkedList * linked_list_cursor_peek(LinkedListCursor *cursor);
+
+/*
+ * @Function linked_list_cursor_next
+ * @Params
+ * 		LinkedListCursor *cursor
+ * 		# cursor which will be moved #
+ * @Return LinkedList * # new current cell or NULL #
+ * @Description
+ * 		This function moves the cursor to the following cell, and returns it.
+ * 		If the cursor reaches the end, it returns NULL. If the cursor is already at the end, it does not move.
+ */
+extern LinkedList * linked_list_cursor_next(LinkedListCursor *cursor);
+
+/*
+ * @Function linked_list_cursor_next_n
+ * @Params
+ * 		LinkedListCursor *cursor
+ * 		# cursor which will be moved #
+ * 		void **data
+ * 		# array where the data are put #
+ * 		size_t n
+ * 		# size of the array #
+ * @Return size_t # number of data put in the array #
+ * @Description
+ * 		This function puts in data the data of the current cell and of the n - 1 following ones,
+ * 		then moves the cursor after the last of these cells.
+ * 		The data are prefetched as well, for when they are pointers.
+ * 		It returns less than n only when the end of the list is reached.
+ */
+extern size_t linked_list_cursor_next_n(LinkedListCursor *cursor, void **data, size_t n);
+
+/*
+ * @Function linked_list_cursor_erase
+ * @Params
+ * 		LinkedListCursor *cursor
+ * 		# cursor which will be moved #
+ * @Return LinkedList * # new current cell or NULL #
+ * @Description
+ * 		This function removes the current cell from the list in O(1), and moves the cursor to the following cell, which it returns.
+ * 		Like remove_first_occurrence, the cell is freed but not its data.
+ * 		If the cursor is at the end, nothing is done and it returns NULL.
+ */
+extern LinkedList * linked_list_cursor_erase(LinkedListCursor *cursor);
+
+/*
+ * @Function linked_list_cursor_insert
+ * @Params
+ * 		LinkedListCursor *cursor
+ * 		# cursor which will be moved #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the data from the structure #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the data from the structure #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add the data in parameters before the current cell in O(1), or at the end of the list if the cursor is at the end.
+ * 		The cursor stays on its cell, so the new data is not traversed.
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int linked_list_cursor_insert(LinkedListCursor *cursor, void *data, void (*print_data)(void *data), void (*free_data)(void **data));
+
+
+#endif /* HEADER_LINKED_LIST_CURSOR_H_ */
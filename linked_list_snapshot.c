@@ -0,0 +1,298 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "linked_list_snapshot.h"
+
+
+#define SNAPSHOT_MAGIC "LLSNAP\0\0"
+#define SNAPSHOT_BYTE_ORDER 0x01020304U
+#define SNAPSHOT_VERSION 1U
+#define DEFAULT_ENCODE_BUFFER_SIZE 256
+
+/* padding of a node, so the next node is aligned on 8 bytes */
+#define NODE_PADDING(length) ((8 - ((length) & 7)) & 7)
+
+
+struct _snapshot_header {
+	char magic[8]; /* SNAPSHOT_MAGIC */
+	uint32_t byte_order; /* SNAPSHOT_BYTE_ORDER written in the byte order of the machine */
+	uint32_t version; /* SNAPSHOT_VERSION */
+	uint64_t length; /* length of the file */
+	uint64_t size; /* number of nodes */
+	uint64_t first; /* offset of the first node from the start of the file, 0 if the list is empty */
+};
+
+/*
+ * This function encodes data in *buffer, which grows if the data does not fit.
+ * It returns the number of bytes of the encoded data, or a negative value if there were a problem.
+ */
+static long encode_cell(void *data, int (*encode_data)(void *data, char *buffer, size_t size), char **buffer, size_t *size) {
+
+	int length;
+	char *tmp;
+
+	length = encode_data(data, *buffer, *size);
+	if (length < 0) {
+		fprintf(stderr, "error: encoding fail.\n");
+		return -1;
+	}
+	if ((size_t)length <= *size)
+		return length;
+
+	tmp = (char *)realloc(*buffer, (size_t)length);
+	if (NULL == tmp) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return -1;
+	}
+	*buffer = tmp;
+	*size = (size_t)length;
+	length = encode_data(data, *buffer, *size);
+	if (length < 0 || (size_t)length > *size) {
+		fprintf(stderr, "error: encoding fail.\n");
+		return -1;
+	}
+
+	return length;
+
+}
+
+/*
+ * This function writes the nodes of list on stream, after the header, and fills the header.
+ * It returns 0 if there were a problem.
+ * Else it returns 1.
+ */
+static int write_nodes(FILE *stream, LinkedList *list, int (*encode_data)(void *data, char *buffer, size_t size), struct _snapshot_header *header) {
+
+	static const char padding[8] = {0};
+	size_t size = DEFAULT_ENCODE_BUFFER_SIZE;
+	char *buffer = (char *)malloc(size);
+	LinkedListSnapshotNode node;
+	uint64_t offset = sizeof(struct _snapshot_header);
+	long length;
+
+	if (NULL == buffer) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return 0;
+	}
+
+	header->first = (NULL == list) ? 0 : offset;
+	for (; list != NULL; list = list->next) {
+		length = encode_cell(list->data, encode_data, &buffer, &size);
+		if (length < 0)
+			break;
+		node.length = (uint64_t)length;
+		node.next = (NULL == list->next) ? 0 : sizeof(LinkedListSnapshotNode) + node.length + NODE_PADDING(node.length);
+		if (fwrite(&node, sizeof(LinkedListSnapshotNode), 1, stream) != 1
+				|| fwrite(buffer, 1, (size_t)length, stream) != (size_t)length
+				|| fwrite(padding, 1, NODE_PADDING(node.length), stream) != NODE_PADDING(node.length))
+			break;
+		offset += sizeof(LinkedListSnapshotNode) + node.length + NODE_PADDING(node.length);
+		header->size += 1;
+	}
+	header->length = offset;
+
+	free(buffer);
+
+	return (NULL == list);
+
+}
+
+/*
+ * This function writes list in the snapshot file path, through a temporary file renamed over path.
+ * It returns 0 if there were a problem, and path is unchanged.
+ * Else it returns 1.
+ */
+int save_linked_list_snapshot(LinkedList *list, const char *path, int (*encode_data)(void *data, char *buffer, size_t size)) {
+
+	struct _snapshot_header header;
+	FILE *stream;
+	char *temporary;
+	size_t length = strlen(path);
+	int ret;
+
+	/* the snapshot is written beside path, then renamed over it, so path always holds a whole snapshot */
+	temporary = (char *)malloc(length + sizeof(".tmp"));
+	if (NULL == temporary) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return 0;
+	}
+	memcpy(temporary, path, length);
+	memcpy(temporary + length, ".tmp", sizeof(".tmp"));
+
+	stream = fopen(temporary, "wb");
+	if (NULL == stream) {
+		perror(temporary);
+		free(temporary);
+		return 0;
+	}
+
+	memset(&header, 0, sizeof(struct _snapshot_header));
+	memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+	header.byte_order = SNAPSHOT_BYTE_ORDER;
+	header.version = SNAPSHOT_VERSION;
+
+	/* the header is written twice : its place first, then its content once the nodes are counted */
+	ret = (fwrite(&header, sizeof(struct _snapshot_header), 1, stream) == 1)
+		&& write_nodes(stream, list, encode_data, &header)
+		&& fseek(stream, 0, SEEK_SET) == 0
+		&& fwrite(&header, sizeof(struct _snapshot_header), 1, stream) == 1
+		&& fflush(stream) == 0
+		&& fsync(fileno(stream)) == 0;
+	if (fclose(stream) != 0)
+		ret = 0;
+	if (ret && rename(temporary, path) != 0) {
+		perror(path);
+		ret = 0;
+	}
+	if (!ret) {
+		fprintf(stderr, "error: cannot write the snapshot %s.\n", path);
+		remove(temporary);
+	}
+
+	free(temporary);
+
+	return ret;
+
+}
+
+/*
+ * This function maps the snapshot file path and checks its header.
+ * It returns 0 if there were a problem.
+ * Else it returns 1.
+ */
+int open_linked_list_snapshot(LinkedListSnapshot *snapshot, const char *path) {
+
+	const struct _snapshot_header *header;
+	struct stat status;
+	void *base;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		perror(path);
+		return 0;
+	}
+	if (fstat(fd, &status) != 0 || status.st_size < (off_t)sizeof(struct _snapshot_header)) {
+		fprintf(stderr, "error: %s is not a snapshot.\n", path);
+		close(fd);
+		return 0;
+	}
+	base = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (MAP_FAILED == base) {
+		perror(path);
+		return 0;
+	}
+
+	header = (const struct _snapshot_header *)base;
+	if (memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0
+			|| header->byte_order != SNAPSHOT_BYTE_ORDER
+			|| header->version != SNAPSHOT_VERSION
+			|| header->length != (uint64_t)status.st_size) {
+		fprintf(stderr, "error: %s is not a snapshot of this machine, or is truncated.\n", path);
+		munmap(base, (size_t)status.st_size);
+		return 0;
+	}
+
+	snapshot->base = (const unsigned char *)base;
+	snapshot->length = (size_t)status.st_size;
+	snapshot->size = (size_t)header->size;
+	snapshot->first = header->first;
+
+	return 1;
+
+}
+
+/*
+ * This function unmaps the file of snapshot.
+ */
+void close_linked_list_snapshot(LinkedListSnapshot *snapshot) {
+
+	if (snapshot->base != NULL)
+		munmap((void *)snapshot->base, snapshot->length);
+	snapshot->base = NULL;
+	snapshot->length = 0;
+	snapshot->size = 0;
+	snapshot->first = 0;
+
+}
+
+/*
+ * This function returns the node at offset in snapshot.
+ * It returns NULL if the node is not aligned, or if it or its data are out of the file.
+ */
+static const LinkedListSnapshotNode * node_at(const LinkedListSnapshot *snapshot, uint64_t offset) {
+
+	const LinkedListSnapshotNode *node;
+
+	if ((offset & 7) != 0 || offset > snapshot->length || snapshot->length - offset < sizeof(LinkedListSnapshotNode)) {
+		fprintf(stderr, "error: damaged snapshot.\n");
+		return NULL;
+	}
+	node = (const LinkedListSnapshotNode *)(snapshot->base + offset);
+	if (node->length > snapshot->length - offset - sizeof(LinkedListSnapshotNode)) {
+		fprintf(stderr, "error: damaged snapshot.\n");
+		return NULL;
+	}
+
+	return node;
+
+}
+
+/*
+ * This function returns the first node of snapshot, or NULL.
+ */
+const LinkedListSnapshotNode * linked_list_snapshot_first(const LinkedListSnapshot *snapshot) {
+
+	if (0 == snapshot->first)
+		return NULL;
+
+	return node_at(snapshot, snapshot->first);
+
+}
+
+/*
+ * This function returns the node after node, or NULL.
+ * A node can only point after its data, so the traversal cannot loop.
+ */
+const LinkedListSnapshotNode * linked_list_snapshot_next(const LinkedListSnapshot *snapshot, const LinkedListSnapshotNode *node) {
+
+	if (0 == node->next)
+		return NULL;
+	if (node->next < sizeof(LinkedListSnapshotNode) + node->length || node->next > snapshot->length) {
+		fprintf(stderr, "error: damaged snapshot.\n");
+		return NULL;
+	}
+
+	return node_at(snapshot, (uint64_t)((const unsigned char *)node - snapshot->base) + node->next);
+
+}
+
+/*
+ * This function searches the first node of snapshot whose data is equal to target_data.
+ * It returns the node, or NULL if target_data is not present.
+ */
+const LinkedListSnapshotNode * snapshot_find_first_occurrence(const LinkedListSnapshot *snapshot, const void *target_data, int (*cmp_data)(const void *data, size_t length, const void *target_data)) {
+
+	const LinkedListSnapshotNode *node = linked_list_snapshot_first(snapshot);
+
+	while (node != NULL && cmp_data(node->data, (size_t)node->length, target_data) != 0)
+		node = linked_list_snapshot_next(snapshot, node);
+
+	return node;
+
+}
+
+/*
+ * This function returns the number of nodes of snapshot, in O(1).
+ */
+size_t linked_list_snapshot_size(const LinkedListSnapshot *snapshot) {
+
+	return snapshot->size;
+
+}
@@ -0,0 +1,141 @@
+#ifndef HEADER_LINKED_LIST_SNAPSHOT_H_
+#define HEADER_LINKED_LIST_SNAPSHOT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "linked_list.h"
+
+
+struct _snapshot_node {
+	uint64_t next; /* offset from this node to the next node, 0 for the last node */
+	uint64_t length; /* number of bytes of data */
+	unsigned char data[]; /* data encoded by the encode_data function given to save_linked_list_snapshot */
+};
+/*
+ * Node of a snapshot file, read in place in the mapped file : it must never be modified.
+ * The offsets are relative, so the file can be mapped at any address.
+ * Nodes are aligned on 8 bytes.
+ */
+
+typedef struct _snapshot_node LinkedListSnapshotNode;
+
+struct _linked_list_snapshot {
+	const unsigned char *base; /* address where the file is mapped */
+	size_t length; /* length of the file */
+	size_t size; /* number of nodes */
+	uint64_t first; /* offset of the first node from base, 0 if the list is empty */
+};
+/*
+ * Read only list mapped from a snapshot file.
+ * Opening it reads only the header of the file : the nodes are loaded by the system when they are read.
+ */
+
+typedef struct _linked_list_snapshot LinkedListSnapshot;
+
+
+/*
+ * @Function save_linked_list_snapshot
+ * @Params
+ * 		LinkedList *list
+ * 		# LinkedList to save #
+ * 		const char *path
+ * 		# path of the snapshot file #
+ * 		int (*encode_data)(void *data, char *buffer, size_t size)
+ * 		# pointer to a function which encodes data in buffer #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function writes list in the snapshot file path, in one pass, replacing the file if it exists.
+ * 		The snapshot is written in the file path followed by ".tmp", synchronized to the disk, then renamed to path :
+ * 		path holds either the old snapshot or the new one, even if the program stops while writing.
+ * 		encode_data writes at most size bytes in buffer and returns the number of bytes the data needs
+ * 		(the data fits if this number is at most size), or a negative value on error.
+ * 		The file is in the byte order of the machine, it must be opened on a machine with the same byte order.
+ * 		It returns 0 if there were an allocation, encoding or writing problem : the file path is then unchanged.
+ * 		Else it returns 1.
+ */
+extern int save_linked_list_snapshot(LinkedList *list, const char *path, int (*encode_data)(void *data, char *buffer, size_t size));
+
+/*
+ * @Function open_linked_list_snapshot
+ * @Params
+ * 		LinkedListSnapshot *snapshot
+ * 		# LinkedListSnapshot to initialize #
+ * 		const char *path
+ * 		# path of a file written by save_linked_list_snapshot #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function maps the file path in memory with mmap(2), read only, and checks its header.
+ * 		No node is read nor allocated : the time does not depend on the number of nodes.
+ * 		It returns 0 if the file cannot be opened or mapped, or is not a snapshot file.
+ * 		Else it returns 1.
+ */
+extern int open_linked_list_snapshot(LinkedListSnapshot *snapshot, const char *path);
+
+/*
+ * @Function close_linked_list_snapshot
+ * @Params
+ * 		LinkedListSnapshot *snapshot
+ * 		# LinkedListSnapshot to close #
+ * @Return void
+ * @Description
+ * 		This function unmaps the file of snapshot.
+ * 		The nodes of snapshot cannot be used after.
+ */
+extern void close_linked_list_snapshot(LinkedListSnapshot *snapshot);
+
+/*
+ * @Function linked_list_snapshot_first
+ * @Params
+ * 		const LinkedListSnapshot *snapshot
+ * 		# LinkedListSnapshot to read #
+ * @Return const LinkedListSnapshotNode * # first node, or NULL #
+ * @Description
+ * 		This function returns the first node of snapshot.
+ * 		It returns NULL if snapshot is empty or if the node is out of the file.
+ */
+extern const LinkedListSnapshotNode * linked_list_snapshot_first(const LinkedListSnapshot *snapshot);
+
+/*
+ * @Function linked_list_snapshot_next
+ * @Params
+ * 		const LinkedListSnapshot *snapshot
+ * 		# LinkedListSnapshot to read #
+ * 		const LinkedListSnapshotNode *node
+ * 		# node of snapshot #
+ * @Return const LinkedListSnapshotNode * # next node, or NULL #
+ * @Description
+ * 		This function returns the node after node.
+ * 		It returns NULL if node is the last node, or if the next node is out of the file
+ * 		(a damaged file cannot make the traversal read outside of the file, nor loop).
+ */
+extern const LinkedListSnapshotNode * linked_list_snapshot_next(const LinkedListSnapshot *snapshot, const LinkedListSnapshotNode *node);
+
+/*
+ * @Function snapshot_find_first_occurrence
+ * @Params
+ * 		const LinkedListSnapshot *snapshot
+ * 		# LinkedListSnapshot where target_data is searched #
+ * 		const void *target_data
+ * 		# data to find #
+ * 		int (*cmp_data)(const void *data, size_t length, const void *target_data)
+ * 		# pointer to a function which compares the encoded data of a node to target_data #
+ * @Return const LinkedListSnapshotNode * # node where target_data is, or NULL #
+ * @Description
+ * 		This function searches the first node whose data is equal to target_data (cmp_data returns 0).
+ * 		It returns the node, or NULL if target_data is not present in snapshot.
+ */
+extern const LinkedListSnapshotNode * snapshot_find_first_occurrence(const LinkedListSnapshot *snapshot, const void *target_data, int (*cmp_data)(const void *data, size_t length, const void *target_data));
+
+/*
+ * @Function linked_list_snapshot_size
+ * @Params
+ * 		const LinkedListSnapshot *snapshot
+ * 		# LinkedListSnapshot to count #
+ * @Return size_t # number of nodes #
+ * @Description
+ * 		This function returns the number of nodes of snapshot, in O(1), from the header of the file.
+ */
+extern size_t linked_list_snapshot_size(const LinkedListSnapshot *snapshot);
+
+
+#endif /* HEADER_LINKED_LIST_SNAPSHOT_H_ */
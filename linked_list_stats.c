@@ -0,0 +1,339 @@
+#include <stdio.h>
+#include <string.h>
+#include "linked_list_stats.h"
+
+
+static const char *operation_names[LINKED_LIST_OP_COUNT] = {
+	"add_to_top",
+	"add_at_the_end",
+	"add_after_first_occurrence",
+	"add_before_first_occurrence",
+	"add_after_last_occurrence",
+	"add_before_last_occurrence",
+	"add_sorted",
+	"merge_linked_list",
+	"sort_linked_list",
+	"remove_first_occurrence",
+	"remove_last_occurrence",
+	"remove_all_occurrence",
+	"remove_if",
+	"filter_linked_list",
+	"extract_first_occurrence",
+	"extract_last_occurrence",
+	"find_first_occurrence",
+	"find_last_occurrence",
+	"linked_list_size",
+	"free_linked_list",
+	"add_array_after_first_occurrence",
+	"add_array_after_last_occurrence",
+	"add_array_before_first_occurrence",
+	"add_array_before_last_occurrence",
+	"add_chain_after_first_occurrence",
+	"add_chain_after_last_occurrence",
+	"add_chain_before_first_occurrence",
+	"add_chain_before_last_occurrence",
+	"splice_linked_list",
+	"split_linked_list_at",
+	"split_linked_list_at_first_occurrence",
+	"split_linked_list_in_parts",
+	"find_occurrences",
+	"linked_list_from_array",
+	"linked_list_to_array",
+	"linked_list_compact",
+	"linked_list_compact_step",
+	"free_linked_list_cell",
+	"header_compact",
+};
+
+/*
+ * This function returns the name of the function recorded as operation.
+ */
+const char * linked_list_operation_name(enum linked_list_operation operation) {
+
+	if ((unsigned int)operation >= LINKED_LIST_OP_COUNT)
+		return "unknown";
+
+	return operation_names[operation];
+
+}
+
+#ifdef LINKED_LIST_INSTRUMENTATION
+
+#include <stdatomic.h>
+
+
+struct _atomic_operation_stats {
+	atomic_ulong calls; /* number of calls */
+	atomic_ulong nanoseconds; /* total time of the calls */
+	atomic_ulong visits; /* total number of examined cells */
+	atomic_ulong latency[LINKED_LIST_HISTOGRAM_BUCKETS]; /* histogram of the time of a call */
+	atomic_ulong visited[LINKED_LIST_HISTOGRAM_BUCKETS]; /* histogram of the examined cells */
+};
+
+static struct {
+	atomic_ulong comparisons;
+	atomic_ulong allocations;
+	atomic_ulong pool_allocations;
+	atomic_ulong frees;
+	atomic_ulong pool_frees;
+	struct _atomic_operation_stats operations[LINKED_LIST_OP_COUNT];
+} counters;
+
+/* counters of the calling thread, added to the global counters at the end of an operation */
+_Thread_local unsigned long linked_list_stats_comparisons = 0;
+_Thread_local unsigned long linked_list_stats_visits = 0;
+
+/* number of recorded operations running in the calling thread */
+static _Thread_local unsigned int depth = 0;
+
+/*
+ * This function returns the bucket of value in a histogram.
+ */
+static unsigned int histogram_bucket(unsigned long value) {
+
+	unsigned int bucket = 0;
+
+	while (value != 0 && bucket < LINKED_LIST_HISTOGRAM_BUCKETS - 1) {
+		value >>= 1;
+		bucket += 1;
+	}
+
+	return bucket;
+
+}
+
+/*
+ * This function adds a value to a counter, nobody waits on it.
+ */
+static void add_counter(atomic_ulong *counter, unsigned long value) {
+
+	atomic_fetch_add_explicit(counter, value, memory_order_relaxed);
+
+}
+
+/*
+ * This function reads a counter.
+ */
+static unsigned long read_counter(atomic_ulong *counter) {
+
+	return atomic_load_explicit(counter, memory_order_relaxed);
+
+}
+
+/*
+ * This function starts the recording of an operation.
+ */
+void linked_list_stats_begin(struct _linked_list_probe *probe, enum linked_list_operation operation) {
+
+	probe->operation = operation;
+	probe->outermost = (0 == depth);
+	depth += 1;
+	if (!probe->outermost)
+		return;
+	probe->visits = linked_list_stats_visits;
+	timespec_get(&(probe->start), TIME_UTC);
+
+}
+
+/*
+ * This function ends the recording of an operation,
+ * and adds its time and its examined cells to the counters.
+ */
+void linked_list_stats_end(struct _linked_list_probe *probe) {
+
+	struct _atomic_operation_stats *stats = &(counters.operations[probe->operation]);
+	struct timespec end;
+	unsigned long nanoseconds, visits;
+
+	depth -= 1;
+	if (!probe->outermost)
+		return;
+	timespec_get(&end, TIME_UTC);
+	nanoseconds = (unsigned long)(end.tv_sec - probe->start.tv_sec) * 1000000000UL + (unsigned long)end.tv_nsec - (unsigned long)probe->start.tv_nsec;
+	visits = linked_list_stats_visits - probe->visits;
+
+	add_counter(&(stats->calls), 1);
+	add_counter(&(stats->nanoseconds), nanoseconds);
+	add_counter(&(stats->visits), visits);
+	add_counter(&(stats->latency[histogram_bucket(nanoseconds)]), 1);
+	add_counter(&(stats->visited[histogram_bucket(visits)]), 1);
+	if (linked_list_stats_comparisons != 0) {
+		add_counter(&(counters.comparisons), linked_list_stats_comparisons);
+		linked_list_stats_comparisons = 0;
+	}
+
+}
+
+/*
+ * This function counts the allocation of a cell.
+ */
+void linked_list_stats_allocation(int from_pool) {
+
+	add_counter(from_pool ? &(counters.pool_allocations) : &(counters.allocations), 1);
+
+}
+
+/*
+ * This function counts the release of a cell.
+ */
+void linked_list_stats_free(int to_pool) {
+
+	add_counter(to_pool ? &(counters.pool_frees) : &(counters.frees), 1);
+
+}
+
+int linked_list_stats_enabled(void) {
+
+	return 1;
+
+}
+
+/*
+ * This function copies all the counters in stats.
+ * The comparisons of the operations running in the other threads are not counted yet.
+ */
+void get_linked_list_stats(LinkedListStats *stats) {
+
+	unsigned int i, b;
+
+	stats->comparisons = read_counter(&(counters.comparisons)) + linked_list_stats_comparisons;
+	stats->allocations = read_counter(&(counters.allocations));
+	stats->pool_allocations = read_counter(&(counters.pool_allocations));
+	stats->frees = read_counter(&(counters.frees));
+	stats->pool_frees = read_counter(&(counters.pool_frees));
+	for (i = 0; i < LINKED_LIST_OP_COUNT; i++) {
+		stats->operations[i].calls = read_counter(&(counters.operations[i].calls));
+		stats->operations[i].nanoseconds = read_counter(&(counters.operations[i].nanoseconds));
+		stats->operations[i].visits = read_counter(&(counters.operations[i].visits));
+		for (b = 0; b < LINKED_LIST_HISTOGRAM_BUCKETS; b++) {
+			stats->operations[i].latency[b] = read_counter(&(counters.operations[i].latency[b]));
+			stats->operations[i].visited[b] = read_counter(&(counters.operations[i].visited[b]));
+		}
+	}
+
+}
+
+/*
+ * This function sets all the counters to 0.
+ */
+void reset_linked_list_stats(void) {
+
+	unsigned int i, b;
+
+	atomic_store_explicit(&(counters.comparisons), 0, memory_order_relaxed);
+	atomic_store_explicit(&(counters.allocations), 0, memory_order_relaxed);
+	atomic_store_explicit(&(counters.pool_allocations), 0, memory_order_relaxed);
+	atomic_store_explicit(&(counters.frees), 0, memory_order_relaxed);
+	atomic_store_explicit(&(counters.pool_frees), 0, memory_order_relaxed);
+	for (i = 0; i < LINKED_LIST_OP_COUNT; i++) {
+		atomic_store_explicit(&(counters.operations[i].calls), 0, memory_order_relaxed);
+		atomic_store_explicit(&(counters.operations[i].nanoseconds), 0, memory_order_relaxed);
+		atomic_store_explicit(&(counters.operations[i].visits), 0, memory_order_relaxed);
+		for (b = 0; b < LINKED_LIST_HISTOGRAM_BUCKETS; b++) {
+			atomic_store_explicit(&(counters.operations[i].latency[b]), 0, memory_order_relaxed);
+			atomic_store_explicit(&(counters.operations[i].visited[b]), 0, memory_order_relaxed);
+		}
+	}
+	linked_list_stats_comparisons = 0;
+
+}
+
+/*
+ * This function returns the lowest value of a bucket.
+ */
+static unsigned long bucket_low(unsigned int bucket) {
+
+	return (0 == bucket) ? 0 : 1UL << (bucket - 1);
+
+}
+
+/*
+ * This function estimates a percentile from a histogram of calls values,
+ * by returning the upper bound of the bucket which contains it.
+ */
+static unsigned long histogram_percentile(const unsigned long *histogram, unsigned long calls, unsigned int percent) {
+
+	unsigned long rank = (calls * percent + 99) / 100, seen = 0;
+	unsigned int b;
+
+	for (b = 0; b < LINKED_LIST_HISTOGRAM_BUCKETS; b++) {
+		seen += histogram[b];
+		if (seen >= rank && seen != 0)
+			return (0 == b) ? 0 : (1UL << b) - 1;
+	}
+
+	return 0;
+
+}
+
+/*
+ * This function writes the non empty buckets of a histogram on stream.
+ */
+static void dump_histogram(FILE *stream, const char *title, const unsigned long *histogram) {
+
+	unsigned int b;
+
+	fprintf(stream, "    %s:", title);
+	for (b = 0; b < LINKED_LIST_HISTOGRAM_BUCKETS; b++)
+		if (histogram[b] != 0)
+			fprintf(stream, " [%lu..]=%lu", bucket_low(b), histogram[b]);
+	fprintf(stream, "\n");
+
+}
+
+/*
+ * This function writes all the counters on stream.
+ */
+void dump_linked_list_stats(FILE *stream) {
+
+	LinkedListStats stats;
+	LinkedListOperationStats *operation;
+	unsigned int i;
+
+	get_linked_list_stats(&stats);
+	fprintf(stream, "comparisons: %lu\n", stats.comparisons);
+	fprintf(stream, "allocations: %lu (pool: %lu)\n", stats.allocations, stats.pool_allocations);
+	fprintf(stream, "frees: %lu (pool: %lu)\n", stats.frees, stats.pool_frees);
+	for (i = 0; i < LINKED_LIST_OP_COUNT; i++) {
+		operation = &(stats.operations[i]);
+		if (0 == operation->calls)
+			continue;
+		fprintf(stream, "%s: calls=%lu mean_ns=%lu p50_ns<=%lu p99_ns<=%lu mean_visits=%lu p50_visits<=%lu p99_visits<=%lu\n",
+			linked_list_operation_name((enum linked_list_operation)i), operation->calls,
+			operation->nanoseconds / operation->calls,
+			histogram_percentile(operation->latency, operation->calls, 50),
+			histogram_percentile(operation->latency, operation->calls, 99),
+			operation->visits / operation->calls,
+			histogram_percentile(operation->visited, operation->calls, 50),
+			histogram_percentile(operation->visited, operation->calls, 99));
+		dump_histogram(stream, "latency_ns", operation->latency);
+		dump_histogram(stream, "visits", operation->visited);
+	}
+
+}
+
+#else
+
+int linked_list_stats_enabled(void) {
+
+	return 0;
+
+}
+
+void get_linked_list_stats(LinkedListStats *stats) {
+
+	memset(stats, 0, sizeof(LinkedListStats));
+
+}
+
+void reset_linked_list_stats(void) {
+
+}
+
+void dump_linked_list_stats(FILE *stream) {
+
+	fprintf(stream, "linked_list statistics are disabled, compile with -DLINKED_LIST_INSTRUMENTATION.\n");
+
+}
+
+#endif /* LINKED_LIST_INSTRUMENTATION */
@@ -0,0 +1,212 @@
+#ifndef HEADER_LINKED_LIST_STATS_H_
+#define HEADER_LINKED_LIST_STATS_H_
+
+#include <stdio.h>
+
+
+/*
+ * Instrumentation of linked_list.c, enabled by compiling all the files with -DLINKED_LIST_INSTRUMENTATION
+ * (make INSTRUMENTATION=1).
+ * Without it, the probes of linked_list.c expand to nothing, and the functions below only report that
+ * the instrumentation is disabled.
+ * The counters are shared by all the threads. Only the outermost operation is recorded when an operation calls another one.
+ */
+
+enum linked_list_operation {
+	LINKED_LIST_OP_ADD_TO_TOP, /* add_to_top */
+	LINKED_LIST_OP_ADD_AT_THE_END, /* add_at_the_end */
+	LINKED_LIST_OP_ADD_AFTER_FIRST_OCCURRENCE, /* add_after_first_occurrence */
+	LINKED_LIST_OP_ADD_BEFORE_FIRST_OCCURRENCE, /* add_before_first_occurrence */
+	LINKED_LIST_OP_ADD_AFTER_LAST_OCCURRENCE, /* add_after_last_occurrence */
+	LINKED_LIST_OP_ADD_BEFORE_LAST_OCCURRENCE, /* add_before_last_occurrence */
+	LINKED_LIST_OP_ADD_SORTED, /* add_sorted */
+	LINKED_LIST_OP_MERGE, /* merge_linked_list */
+	LINKED_LIST_OP_SORT, /* sort_linked_list */
+	LINKED_LIST_OP_REMOVE_FIRST_OCCURRENCE, /* remove_first_occurrence */
+	LINKED_LIST_OP_REMOVE_LAST_OCCURRENCE, /* remove_last_occurrence */
+	LINKED_LIST_OP_REMOVE_ALL_OCCURRENCE, /* remove_all_occurrence */
+	LINKED_LIST_OP_REMOVE_IF, /* remove_if */
+	LINKED_LIST_OP_FILTER, /* filter_linked_list */
+	LINKED_LIST_OP_EXTRACT_FIRST_OCCURRENCE, /* extract_first_occurrence */
+	LINKED_LIST_OP_EXTRACT_LAST_OCCURRENCE, /* extract_last_occurrence */
+	LINKED_LIST_OP_FIND_FIRST_OCCURRENCE, /* find_first_occurrence */
+	LINKED_LIST_OP_FIND_LAST_OCCURRENCE, /* find_last_occurrence */
+	LINKED_LIST_OP_SIZE, /* linked_list_size */
+	LINKED_LIST_OP_FREE, /* free_linked_list */
+	LINKED_LIST_OP_ADD_ARRAY_AFTER_FIRST_OCCURRENCE, /* add_array_after_first_occurrence */
+	LINKED_LIST_OP_ADD_ARRAY_AFTER_LAST_OCCURRENCE, /* add_array_after_last_occurrence */
+	LINKED_LIST_OP_ADD_ARRAY_BEFORE_FIRST_OCCURRENCE, /* add_array_before_first_occurrence */
+	LINKED_LIST_OP_ADD_ARRAY_BEFORE_LAST_OCCURRENCE, /* add_array_before_last_occurrence */
+	LINKED_LIST_OP_ADD_CHAIN_AFTER_FIRST_OCCURRENCE, /* add_chain_after_first_occurrence */
+	LINKED_LIST_OP_ADD_CHAIN_AFTER_LAST_OCCURRENCE, /* add_chain_after_last_occurrence */
+	LINKED_LIST_OP_ADD_CHAIN_BEFORE_FIRST_OCCURRENCE, /* add_chain_before_first_occurrence */
+	LINKED_LIST_OP_ADD_CHAIN_BEFORE_LAST_OCCURRENCE, /* add_chain_before_last_occurrence */
+	LINKED_LIST_OP_SPLICE, /* splice_linked_list */
+	LINKED_LIST_OP_SPLIT_AT, /* split_linked_list_at */
+	LINKED_LIST_OP_SPLIT_AT_FIRST_OCCURRENCE, /* split_linked_list_at_first_occurrence */
+	LINKED_LIST_OP_SPLIT_IN_PARTS, /* split_linked_list_in_parts */
+	LINKED_LIST_OP_FIND_OCCURRENCES, /* find_occurrences */
+	LINKED_LIST_OP_FROM_ARRAY, /* linked_list_from_array */
+	LINKED_LIST_OP_TO_ARRAY, /* linked_list_to_array */
+	LINKED_LIST_OP_COMPACT, /* linked_list_compact */
+	LINKED_LIST_OP_COMPACT_STEP, /* linked_list_compact_step */
+	LINKED_LIST_OP_FREE_CELL, /* free_linked_list_cell */
+	LINKED_LIST_OP_HEADER_COMPACT, /* header_compact */
+	LINKED_LIST_OP_COUNT /* number of operations */
+};
+/*
+ * Operations of linked_list.h which are recorded. The functions on a LinkedListHeader are recorded as their LinkedList version.
+ * The pools, add_list, the compaction state functions, and the print and write functions are not recorded.
+ */
+
+#define LINKED_LIST_HISTOGRAM_BUCKETS 40
+/*
+ * Number of buckets of the histograms : bucket 0 counts the value 0, and bucket b the values from 2^(b-1) to 2^b - 1.
+ * The last bucket also counts the greater values.
+ */
+
+struct _linked_list_operation_stats {
+	unsigned long calls; /* number of calls */
+	unsigned long nanoseconds; /* total time of the calls */
+	unsigned long visits; /* total number of cells examined by cmp_data or a predicate */
+	unsigned long latency[LINKED_LIST_HISTOGRAM_BUCKETS]; /* histogram of the time of a call, in nanoseconds */
+	unsigned long visited[LINKED_LIST_HISTOGRAM_BUCKETS]; /* histogram of the cells examined by a call */
+};
+
+typedef struct _linked_list_operation_stats LinkedListOperationStats;
+
+struct _linked_list_stats {
+	unsigned long comparisons; /* calls to cmp_data */
+	unsigned long allocations; /* cells allocated with malloc(3) */
+	unsigned long pool_allocations; /* cells taken from a pool */
+	unsigned long frees; /* cells freed with free(3) */
+	unsigned long pool_frees; /* cells given back to a pool */
+	LinkedListOperationStats operations[LINKED_LIST_OP_COUNT]; /* statistics of each operation */
+};
+/*
+ * Copy of the counters, returned by get_linked_list_stats.
+ */
+
+typedef struct _linked_list_stats LinkedListStats;
+
+
+/*
+ * @Function linked_list_stats_enabled
+ * @Params
+ * 		void
+ * 		# nothing #
+ * @Return int # 1 if the instrumentation is compiled, else 0 #
+ * @Description
+ * 		This function tells if linked_list.c has been compiled with LINKED_LIST_INSTRUMENTATION.
+ */
+extern int linked_list_stats_enabled(void);
+
+/*
+ * @Function linked_list_operation_name
+ * @Params
+ * 		enum linked_list_operation operation
+ * 		# operation whose name is wanted #
+ * @Return const char * # name of the function of linked_list.h #
+ * @Description
+ * 		This function returns the name of the function recorded as operation, or "unknown".
+ */
+extern const char * linked_list_operation_name(enum linked_list_operation operation);
+
+/*
+ * @Function get_linked_list_stats
+ * @Params
+ * 		LinkedListStats *stats
+ * 		# structure where the counters are copied #
+ * @Return void
+ * @Description
+ * 		This function copies all the counters in stats.
+ * 		Without instrumentation, all the counters are 0.
+ */
+extern void get_linked_list_stats(LinkedListStats *stats);
+
+/*
+ * @Function reset_linked_list_stats
+ * @Params
+ * 		void
+ * 		# nothing #
+ * @Return void
+ * @Description
+ * 		This function sets all the counters to 0.
+ */
+extern void reset_linked_list_stats(void);
+
+/*
+ * @Function dump_linked_list_stats
+ * @Params
+ * 		FILE *stream
+ * 		# stream where the counters are written #
+ * @Return void
+ * @Description
+ * 		This function writes the counters on stream : the global counters, then one line per operation which has been called,
+ * 		with the mean and the estimated median and 99th percentile of its time and of its examined cells,
+ * 		then the non empty buckets of its histograms.
+ */
+extern void dump_linked_list_stats(FILE *stream);
+
+
+/*
+ * Probes used by linked_list.c.
+ */
+#ifdef LINKED_LIST_INSTRUMENTATION
+
+#include <time.h>
+
+struct _linked_list_probe {
+	enum linked_list_operation operation; /* recorded operation */
+	int outermost; /* 1 if the operation is not called by another recorded operation */
+	struct timespec start; /* time of the call */
+	unsigned long visits; /* cells examined by the thread before the call */
+};
+
+extern _Thread_local unsigned long linked_list_stats_comparisons;
+extern _Thread_local unsigned long linked_list_stats_visits;
+
+extern void linked_list_stats_begin(struct _linked_list_probe *probe, enum linked_list_operation operation);
+extern void linked_list_stats_end(struct _linked_list_probe *probe);
+extern void linked_list_stats_allocation(int from_pool);
+extern void linked_list_stats_free(int to_pool);
+
+#define LINKED_LIST_PROBE_BEGIN(operation) \
+	struct _linked_list_probe linked_list_probe; \
+	linked_list_stats_begin(&linked_list_probe, (operation))
+#define LINKED_LIST_PROBE_END() linked_list_stats_end(&linked_list_probe)
+#define LINKED_LIST_PROBE_RETURN(type, value) \
+	do { \
+		type linked_list_probe_value = (value); \
+		linked_list_stats_end(&linked_list_probe); \
+		return linked_list_probe_value; \
+	} while (0)
+#define LINKED_LIST_PROBE_RETURN_VOID() \
+	do { \
+		linked_list_stats_end(&linked_list_probe); \
+		return; \
+	} while (0)
+#define LINKED_LIST_COMPARE(cmp_data, data1, data2) \
+	(linked_list_stats_comparisons += 1, linked_list_stats_visits += 1, (cmp_data)((data1), (data2)))
+#define LINKED_LIST_TEST(predicate, data, context) \
+	(linked_list_stats_visits += 1, (predicate)((data), (context)))
+#define LINKED_LIST_VISIT() (linked_list_stats_visits += 1)
+#define LINKED_LIST_COUNT_ALLOCATION(from_pool) linked_list_stats_allocation(from_pool)
+#define LINKED_LIST_COUNT_FREE(to_pool) linked_list_stats_free(to_pool)
+
+#else
+
+#define LINKED_LIST_PROBE_BEGIN(operation) ((void)0)
+#define LINKED_LIST_PROBE_END() ((void)0)
+#define LINKED_LIST_PROBE_RETURN(type, value) return (value)
+#define LINKED_LIST_PROBE_RETURN_VOID() return
+#define LINKED_LIST_COMPARE(cmp_data, data1, data2) ((cmp_data)((data1), (data2)))
+#define LINKED_LIST_TEST(predicate, data, context) ((predicate)((data), (context)))
+#define LINKED_LIST_VISIT() ((void)0)
+#define LINKED_LIST_COUNT_ALLOCATION(from_pool) ((void)0)
+#define LINKED_LIST_COUNT_FREE(to_pool) ((void)0)
+
+#endif /* LINKED_LIST_INSTRUMENTATION */
+
+
+#endif /* HEADER_LINKED_LIST_STATS_H_ */
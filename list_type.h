@@ -0,0 +1,21 @@
+#ifndef HEADER_LIST_TYPE_H_
+#define HEADER_LIST_TYPE_H_
+
+
+struct _list_type {
+	void (*print_data)(void *data); /* pointer to the function which displays a data of the list */
+	void (*free_data)(void **data); /* pointer to the function which frees a data of the list, or NULL */
+	int (*cmp_data)(void *data1, void *data2); /* pointer to the function which compares two data of the list, or NULL */
+	unsigned long (*hash_data)(void *data); /* pointer to the function which hashes a data of the list, or NULL */
+};
+/*
+ * Type descriptor shared by all the cells of a list.
+ * The cells only keep their data, the functions which handle the data are kept once in the ListType.
+ * cmp_data must return 0 for two equal data, and hash_data must return the same value for two equal data.
+ * A ListType must live as long as the lists which use it.
+ */
+
+typedef struct _list_type ListType;
+
+
+#endif /* HEADER_LIST_TYPE_H_ */
@@ -0,0 +1,414 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "parallel_linked_list.h"
+
+
+/*
+ * Part of a list processed by one thread, from first to end (excluded), and its result.
+ */
+struct _segment {
+	LinkedList *first; /* first cell of the segment */
+	LinkedList *end; /* first cell of the next segment, or NULL */
+	void *accumulator; /* result of linked_list_reduce on the segment */
+	LinkedList *mapped; /* result of linked_list_map on the segment */
+	int failed; /* 1 if an allocation failed in linked_list_map */
+};
+
+/*
+ * Traversal shared by the threads of a pool : each thread takes the next segment until there is none.
+ */
+struct _segment_job {
+	void (*process)(struct _segment_job *job, struct _segment *segment); /* function which processes a segment */
+	struct _segment *segments; /* segments of the list */
+	size_t count; /* number of segments */
+	atomic_size_t next; /* index of the next segment to process */
+	void (*callback)(void *data, void *context);
+	void * (*transform)(void *data, void *context);
+	void * (*accumulate)(void *accumulator, void *data, void *context);
+	void *context;
+	void (*print_data)(void *data);
+	void (*free_data)(void **data);
+};
+
+struct _linked_list_worker_pool {
+	pthread_t *threads; /* threads of the pool */
+	unsigned int count; /* number of threads */
+	pthread_mutex_t lock; /* lock of the following fields */
+	pthread_cond_t start; /* signaled when a job is given or when the pool stops */
+	pthread_cond_t done; /* signaled when the last thread ends its part of the job */
+	unsigned long generation; /* number of jobs given */
+	unsigned int busy; /* number of threads working on the job */
+	int stop; /* 1 when the threads must end */
+	struct _segment_job *job; /* current job */
+	pthread_mutex_t submit; /* lock taken by a traversal during all the job */
+};
+
+/*
+ * This function processes segments of the job until there is none left.
+ */
+static void process_segments(struct _segment_job *job) {
+
+	size_t index;
+
+	while ((index = atomic_fetch_add_explicit(&(job->next), 1, memory_order_relaxed)) < job->count)
+		job->process(job, &(job->segments[index]));
+
+}
+
+static void * worker(void *argument) {
+
+	LinkedListWorkerPool *pool = (LinkedListWorkerPool *)argument;
+	unsigned long seen = 0;
+	struct _segment_job *job;
+
+	pthread_mutex_lock(&(pool->lock));
+	while (1) {
+		while (pool->generation == seen && !pool->stop)
+			pthread_cond_wait(&(pool->start), &(pool->lock));
+		if (pool->stop)
+			break;
+		seen = pool->generation;
+		job = pool->job;
+		pthread_mutex_unlock(&(pool->lock));
+
+		process_segments(job);
+
+		pthread_mutex_lock(&(pool->lock));
+		pool->busy -= 1;
+		if (0 == pool->busy)
+			pthread_cond_signal(&(pool->done));
+	}
+	pthread_mutex_unlock(&(pool->lock));
+
+	return NULL;
+
+}
+
+/*
+ * This function gives the job to the threads of the pool, takes part in it, and waits for its end.
+ */
+static void run_job(LinkedListWorkerPool *pool, struct _segment_job *job) {
+
+	pthread_mutex_lock(&(pool->submit));
+
+	pthread_mutex_lock(&(pool->lock));
+	pool->job = job;
+	pool->generation += 1;
+	pool->busy = pool->count;
+	pthread_cond_broadcast(&(pool->start));
+	pthread_mutex_unlock(&(pool->lock));
+
+	process_segments(job);
+
+	pthread_mutex_lock(&(pool->lock));
+	while (pool->busy > 0)
+		pthread_cond_wait(&(pool->done), &(pool->lock));
+	pool->job = NULL;
+	pthread_mutex_unlock(&(pool->lock));
+
+	pthread_mutex_unlock(&(pool->submit));
+
+}
+
+/*
+ * This function cuts list into at most 'wanted' segments of the same length, in one pass.
+ * A cell is kept every 'step' cells, in an array of 2 * wanted checkpoints :
+ * when the array is full, one checkpoint out of two is dropped and the step is doubled.
+ * It returns the number of segments, or 0 if there were an allocation problem.
+ */
+static size_t cut_segments(LinkedList *list, struct _segment *segments, size_t wanted) {
+
+	size_t capacity = 2 * wanted, count = 0, step = 1, position, i, segment_count;
+	LinkedList **checkpoints, *cell;
+
+	checkpoints = (LinkedList **)malloc(capacity * sizeof(LinkedList *));
+	if (NULL == checkpoints) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return 0;
+	}
+
+	for (cell = list, position = 0; cell != NULL; cell = cell->next, position++) {
+		if (position & (step - 1))
+			continue;
+		if (count == capacity) {
+			for (i = 0; i < capacity / 2; i++)
+				checkpoints[i] = checkpoints[2 * i];
+			count = capacity / 2;
+			step <<= 1;
+			if (position & (step - 1))
+				continue;
+		}
+		checkpoints[count++] = cell;
+	}
+
+	segment_count = (count < wanted) ? count : wanted;
+	for (i = 0; i < segment_count; i++) {
+		segments[i].first = checkpoints[i * count / segment_count];
+		segments[i].accumulator = NULL;
+		segments[i].mapped = NULL;
+		segments[i].failed = 0;
+		if (i > 0)
+			segments[i - 1].end = segments[i].first;
+	}
+	if (segment_count > 0)
+		segments[segment_count - 1].end = NULL;
+
+	free(checkpoints);
+
+	return segment_count;
+
+}
+
+/*
+ * This function cuts list into segments and processes them with the threads of the pool.
+ * Without pool, or if the list cannot be cut, list is processed by the calling thread as the segment 'whole'.
+ * It returns the segments, to be freed by the caller if they are not 'whole', and their number in *count.
+ */
+static struct _segment * run_segments(LinkedList *list, struct _segment_job *job, LinkedListWorkerPool *pool, struct _segment *whole, size_t *count) {
+
+	size_t wanted;
+	struct _segment *segments = NULL;
+
+	if (pool != NULL) {
+		wanted = (size_t)(pool->count + 1) * LINKED_LIST_SEGMENTS_PER_THREAD;
+		segments = (struct _segment *)malloc(wanted * sizeof(struct _segment));
+		if (NULL == segments)
+			fprintf(stderr, "error: allocation fail.\n");
+		else if ((*count = cut_segments(list, segments, wanted)) > 0) {
+			job->segments = segments;
+			job->count = *count;
+			atomic_init(&(job->next), 0);
+			run_job(pool, job);
+			return segments;
+		}
+		free(segments);
+	}
+
+	whole->first = list;
+	whole->end = NULL;
+	whole->accumulator = NULL;
+	whole->mapped = NULL;
+	whole->failed = 0;
+	job->process(job, whole);
+	*count = 1;
+
+	return whole;
+
+}
+
+static void foreach_segment(struct _segment_job *job, struct _segment *segment) {
+
+	LinkedList *cell;
+
+	for (cell = segment->first; cell != segment->end; cell = cell->next)
+		job->callback(cell->data, job->context);
+
+}
+
+/*
+ * This function maps the data of segment into new cells allocated with malloc(3) :
+ * the pool of the calling thread is set aside, since the segments are joined by another thread.
+ */
+static void map_segment(struct _segment_job *job, struct _segment *segment) {
+
+	LinkedList *cell, **link = &(segment->mapped);
+	LinkedListPool *previous = use_linked_list_pool(NULL);
+	void *data;
+
+	for (cell = segment->first; cell != segment->end; cell = cell->next) {
+		data = job->transform(cell->data, job->context);
+		if (!add_to_top(link, data, job->print_data, job->free_data)) {
+			if (job->free_data != NULL)
+				job->free_data(&data);
+			segment->failed = 1;
+			break;
+		}
+		link = &((*link)->next);
+	}
+
+	use_linked_list_pool(previous);
+
+}
+
+static void reduce_segment(struct _segment_job *job, struct _segment *segment) {
+
+	LinkedList *cell;
+
+	for (cell = segment->first; cell != segment->end; cell = cell->next)
+		segment->accumulator = job->accumulate(segment->accumulator, cell->data, job->context);
+
+}
+
+/*
+ * This function creates a pool of threads to process the segments of a list.
+ * It returns NULL if there were an allocation problem or if a thread cannot be created.
+ */
+LinkedListWorkerPool * create_linked_list_worker_pool(unsigned int threads) {
+
+	LinkedListWorkerPool *pool = NULL;
+	unsigned int i;
+
+	pool = (LinkedListWorkerPool *)malloc(sizeof(LinkedListWorkerPool));
+	if (NULL == pool) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return NULL;
+	}
+	pool->threads = (pthread_t *)malloc((threads > 0 ? threads : 1) * sizeof(pthread_t));
+	if (NULL == pool->threads) {
+		fprintf(stderr, "error: allocation fail.\n");
+		free(pool);
+		return NULL;
+	}
+
+	pthread_mutex_init(&(pool->lock), NULL);
+	pthread_mutex_init(&(pool->submit), NULL);
+	pthread_cond_init(&(pool->start), NULL);
+	pthread_cond_init(&(pool->done), NULL);
+	pool->generation = 0;
+	pool->busy = 0;
+	pool->stop = 0;
+	pool->job = NULL;
+	pool->count = 0;
+
+	for (i = 0; i < threads; i++) {
+		if (pthread_create(&(pool->threads[i]), NULL, worker, pool) != 0) {
+			fprintf(stderr, "error: thread creation fail.\n");
+			free_linked_list_worker_pool(&pool);
+			return NULL;
+		}
+		pool->count += 1;
+	}
+
+	return pool;
+
+}
+
+/*
+ * This function stops the threads of the pool and frees it.
+ */
+void free_linked_list_worker_pool(LinkedListWorkerPool **pool) {
+
+	unsigned int i;
+
+	if (NULL == *pool)
+		return;
+
+	pthread_mutex_lock(&((*pool)->lock));
+	(*pool)->stop = 1;
+	pthread_cond_broadcast(&((*pool)->start));
+	pthread_mutex_unlock(&((*pool)->lock));
+
+	for (i = 0; i < (*pool)->count; i++)
+		pthread_join((*pool)->threads[i], NULL);
+
+	pthread_mutex_destroy(&((*pool)->lock));
+	pthread_mutex_destroy(&((*pool)->submit));
+	pthread_cond_destroy(&((*pool)->start));
+	pthread_cond_destroy(&((*pool)->done));
+	free((*pool)->threads);
+	free(*pool);
+	*pool = NULL;
+
+}
+
+/*
+ * This function calls callback on each data of list, in parallel if there is a pool.
+ */
+void linked_list_foreach(LinkedList *list, void (*callback)(void *data, void *context), void *context, LinkedListWorkerPool *pool) {
+
+	struct _segment_job job;
+	struct _segment whole, *segments;
+	size_t count;
+
+	if (NULL == pool) {
+		for (; list != NULL; list = list->next)
+			callback(list->data, context);
+		return;
+	}
+
+	job.process = foreach_segment;
+	job.callback = callback;
+	job.context = context;
+	segments = run_segments(list, &job, pool, &whole, &count);
+	if (segments != &whole)
+		free(segments);
+
+}
+
+/*
+ * This function builds a new LinkedList, in the same order as list, with the data returned by transform.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int linked_list_map(LinkedList *list, LinkedList **result, void * (*transform)(void *data, void *context), void *context, void (*print_data)(void *data), void (*free_data)(void **data), LinkedListWorkerPool *pool) {
+
+	struct _segment_job job;
+	struct _segment whole, *segments;
+	LinkedList *mapped = NULL, **link = &mapped;
+	size_t count, i;
+	int failed = 0;
+
+	job.process = map_segment;
+	job.transform = transform;
+	job.context = context;
+	job.print_data = print_data;
+	job.free_data = free_data;
+
+	segments = run_segments(list, &job, pool, &whole, &count);
+
+	/* the segments are linked in order */
+	for (i = 0; i < count; i++) {
+		failed |= segments[i].failed;
+		*link = segments[i].mapped;
+		while (*link != NULL)
+			link = &((*link)->next);
+	}
+	if (segments != &whole)
+		free(segments);
+
+	if (failed) {
+		free_linked_list(&mapped);
+		return 0;
+	}
+
+	*link = *result;
+	*result = mapped;
+
+	return 1;
+
+}
+
+/*
+ * This function accumulates all the data of list, in order, in parallel if there is a pool and a combine function.
+ * It returns the accumulator, or NULL if list is empty.
+ */
+void * linked_list_reduce(LinkedList *list, void * (*accumulate)(void *accumulator, void *data, void *context), void * (*combine)(void *left, void *right, void *context), void *context, LinkedListWorkerPool *pool) {
+
+	struct _segment_job job;
+	struct _segment whole, *segments;
+	void *accumulator = NULL;
+	size_t count, i;
+
+	if (NULL == pool || NULL == combine) {
+		for (; list != NULL; list = list->next)
+			accumulator = accumulate(accumulator, list->data, context);
+		return accumulator;
+	}
+
+	job.process = reduce_segment;
+	job.accumulate = accumulate;
+	job.context = context;
+
+	segments = run_segments(list, &job, pool, &whole, &count);
+
+	accumulator = segments[0].accumulator;
+	for (i = 1; i < count; i++)
+		accumulator = combine(accumulator, segments[i].accumulator, context);
+	if (segments != &whole)
+		free(segments);
+
+	return accumulator;
+
+}
@@ -0,0 +1,117 @@
+#ifndef HEADER_PARALLEL_LINKED_LIST_H_
+#define HEADER_PARALLEL_LINKED_LIST_H_
+
+#include "linked_list.h"
+
+
+#define LINKED_LIST_SEGMENTS_PER_THREAD 4
+/*
+ * Number of segments given to each thread of a pool, so a thread which ends sooner takes another segment.
+ */
+
+typedef struct _linked_list_worker_pool LinkedListWorkerPool;
+/*
+ * Threads created once and used by all the traversals which get the pool.
+ * The chain is cut into balanced segments in one pass, then the segments are processed in parallel,
+ * the calling thread included.
+ * Several threads can use the same pool : their traversals are done one after the other.
+ */
+
+
+/*
+ * @Function create_linked_list_worker_pool
+ * @Params
+ * 		unsigned int threads
+ * 		# number of threads created in addition to the calling thread #
+ * @Return LinkedListWorkerPool * # pointer to the new pool or NULL #
+ * @Description
+ * 		This function creates a pool of threads to process the segments of a list.
+ * 		It returns NULL if there were an allocation problem or if a thread cannot be created.
+ */
+extern LinkedListWorkerPool * create_linked_list_worker_pool(unsigned int threads);
+
+/*
+ * @Function free_linked_list_worker_pool
+ * @Params
+ * 		LinkedListWorkerPool **pool
+ * 		# pointer to the pool which will be freed #
+ * @Return void
+ * @Description
+ * 		This function stops the threads of the pool and frees it.
+ * 		At the end of the function, *pool is NULL.
+ */
+extern void free_linked_list_worker_pool(LinkedListWorkerPool **pool);
+
+/*
+ * @Function linked_list_foreach
+ * @Params
+ * 		LinkedList *list
+ * 		# LinkedList to read #
+ * 		void (*callback)(void *data, void *context)
+ * 		# pointer to the function called on each data of list #
+ * 		void *context
+ * 		# pointer given to each call of the callbacks #
+ * 		LinkedListWorkerPool *pool
+ * 		# pool whose threads process the segments of list #
+ * 		# if NULL, list is processed by the calling thread only #
+ * @Return void
+ * @Description
+ * 		This function calls callback on each data of list.
+ * 		With a pool, the calls are done in parallel and in any order : callback must be thread safe.
+ */
+extern void linked_list_foreach(LinkedList *list, void (*callback)(void *data, void *context), void *context, LinkedListWorkerPool *pool);
+
+/*
+ * @Function linked_list_map
+ * @Params
+ * 		LinkedList *list
+ * 		# LinkedList to read #
+ * 		LinkedList **result
+ * 		# pointer to the LinkedList where the new data are put #
+ * 		void * (*transform)(void *data, void *context)
+ * 		# pointer to the function which returns the new data of a data of list #
+ * 		void *context
+ * 		# pointer given to each call of the callbacks #
+ * 		void (*print_data)(void *data)
+ * 		# pointer to the function which displays the new data #
+ * 		void (*free_data)(void **data)
+ * 		# pointer to the function which frees the new data #
+ * 		LinkedListWorkerPool *pool
+ * 		# pool whose threads process the segments of list #
+ * 		# if NULL, list is processed by the calling thread only #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function builds a new LinkedList, in the same order as list, with the data returned by transform.
+ * 		The new LinkedList is put at the top of *result.
+ * 		With a pool, the calls to transform are done in parallel : transform must be thread safe.
+ * 		The new cells are allocated with malloc(3), even if the calling thread uses a LinkedListPool.
+ * 		It returns 0 if there were an allocation problem, then *result is not modified.
+ * 		Else it returns 1.
+ */
+extern int linked_list_map(LinkedList *list, LinkedList **result, void * (*transform)(void *data, void *context), void *context, void (*print_data)(void *data), void (*free_data)(void **data), LinkedListWorkerPool *pool);
+
+/*
+ * @Function linked_list_reduce
+ * @Params
+ * 		LinkedList *list
+ * 		# LinkedList to read #
+ * 		void * (*accumulate)(void *accumulator, void *data, void *context)
+ * 		# pointer to the function which returns the accumulator with a data of list added #
+ * 		# the first call of a segment gets a NULL accumulator #
+ * 		void * (*combine)(void *left, void *right, void *context)
+ * 		# pointer to the function which returns the union of two accumulators, left being before right in list #
+ * 		# if NULL, list is processed by the calling thread only #
+ * 		void *context
+ * 		# pointer given to each call of the callbacks #
+ * 		LinkedListWorkerPool *pool
+ * 		# pool whose threads process the segments of list #
+ * 		# if NULL, list is processed by the calling thread only #
+ * @Return void * # accumulator of all the data of list, or NULL if list is empty #
+ * @Description
+ * 		This function accumulates all the data of list, in order.
+ * 		With a pool, each segment is accumulated in parallel, then the accumulators are combined from the left to the right.
+ */
+extern void * linked_list_reduce(LinkedList *list, void * (*accumulate)(void *accumulator, void *data, void *context), void * (*combine)(void *left, void *right, void *context), void *context, LinkedListWorkerPool *pool);
+
+
+#endif /* HEADER_PARALLEL_LINKED_LIST_H_ */
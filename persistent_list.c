@@ -0,0 +1,371 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "persistent_list.h"
+
+
+/*
+ * This function adds a reference to cell, if it is not NULL.
+ */
+static void retain_cell(PersistentCell *cell) {
+
+	if (cell != NULL)
+		atomic_fetch_add_explicit(&(cell->references), 1, memory_order_relaxed);
+
+}
+
+/*
+ * This function releases the use of the data of cell by cell.
+ * The data is freed with the owner of the data when no cell uses it anymore.
+ * cell must not be used after.
+ */
+static void release_data(const ListType *type, PersistentCell *cell) {
+
+	PersistentCell *owner = cell->owner;
+
+	/* the owner keeps its memory until its copies are freed, so they can reach the counter */
+	if (cell != owner)
+		free(cell);
+
+	if (atomic_fetch_sub_explicit(&(owner->data_references), 1, memory_order_acq_rel) == 1) {
+		if (type->free_data != NULL)
+			type->free_data(&(owner->data));
+		free(owner);
+	}
+
+}
+
+/*
+ * This function releases a reference to cell.
+ * The cells which are not referenced anymore are freed, iteratively, so that long lists do not overflow the stack.
+ */
+static void release_cell(const ListType *type, PersistentCell *cell) {
+
+	PersistentCell *next;
+
+	while (cell != NULL && atomic_fetch_sub_explicit(&(cell->references), 1, memory_order_acq_rel) == 1) {
+		next = cell->next;
+		release_data(type, cell);
+		cell = next;
+	}
+
+}
+
+/*
+ * This function create a PersistentCell allocated with malloc(3), referenced once, which owns data.
+ * The new cell takes the reference to next given by the caller.
+ * It returns NULL if there were an allocation problem.
+ */
+static PersistentCell * alloc_persistent_cell(void *data, PersistentCell *next) {
+
+	PersistentCell *cell = NULL;
+
+	cell = (PersistentCell *)malloc(sizeof(PersistentCell));
+	if (NULL == cell) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return NULL;
+	}
+
+	cell->data = data;
+	cell->next = next;
+	atomic_init(&(cell->references), 1);
+	atomic_init(&(cell->data_references), 1);
+	cell->owner = cell;
+
+	return cell;
+
+}
+
+/*
+ * This function create a copy of cell, which shares the data of cell and whose 'next' is NULL.
+ * It returns NULL if there were an allocation problem.
+ */
+static PersistentCell * copy_persistent_cell(const PersistentCell *cell) {
+
+	PersistentCell *copy = alloc_persistent_cell(cell->data, NULL);
+
+	if (NULL == copy)
+		return NULL;
+
+	copy->owner = cell->owner;
+	atomic_init(&(copy->data_references), 0);
+	atomic_fetch_add_explicit(&(copy->owner->data_references), 1, memory_order_relaxed);
+
+	return copy;
+
+}
+
+/*
+ * This function makes the first count cells of list reached only by list, copying the shared ones (copy on write).
+ * A cell referenced more than once is shared, and so are all the cells after it.
+ * It returns the link to the cell at position count (the field 'next' of the last of these cells, or the head),
+ * or NULL if there were an allocation problem (list is then not modified).
+ */
+static PersistentCell ** own_prefix(PersistentList *list, size_t count) {
+
+	PersistentCell **link = &(list->head), *shared, *tmp, *copies = NULL, *last_copy = NULL, *copy;
+	size_t position = 0;
+
+	while (position < count && atomic_load_explicit(&((*link)->references), memory_order_acquire) == 1) {
+		link = &((*link)->next);
+		position += 1;
+	}
+	if (position == count)
+		return link;
+
+	shared = *link;
+	for (tmp = shared; position < count; position++, tmp = tmp->next) {
+		copy = copy_persistent_cell(tmp);
+		if (NULL == copy) {
+			release_cell(list->type, copies);
+			return NULL;
+		}
+		if (NULL == last_copy)
+			copies = copy;
+		else
+			last_copy->next = copy;
+		last_copy = copy;
+	}
+
+	/* the copies lead to the rest of the shared cells, which list now reaches through them */
+	last_copy->next = tmp;
+	retain_cell(tmp);
+	*link = copies;
+	release_cell(list->type, shared);
+
+	return &(last_copy->next);
+
+}
+
+/*
+ * This function returns the position of the first cell of list whose data is equal to target_data.
+ * It returns list->size if target_data has not been found.
+ */
+static size_t search_position(const PersistentList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	const PersistentCell *tmp = list->head;
+	size_t position = 0;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	while (tmp != NULL && cmp_data(tmp->data, target_data) != 0) {
+		tmp = tmp->next;
+		position += 1;
+	}
+
+	return position;
+
+}
+
+/*
+ * This function initializes list as an empty list of data of the given type.
+ */
+void init_persistent_list(PersistentList *list, const ListType *type) {
+
+	list->type = type;
+	list->head = NULL;
+	list->size = 0;
+
+}
+
+/*
+ * This function releases the reference of list to its cells, and frees the cells reached by no other list.
+ * At the end of the function, list is an empty list.
+ */
+void free_persistent_list(PersistentList *list) {
+
+	release_cell(list->type, list->head);
+
+	init_persistent_list(list, list->type);
+
+}
+
+/*
+ * This function gives to copy the cells of list, in O(1).
+ */
+void share_persistent_list(PersistentList *copy, const PersistentList *list) {
+
+	retain_cell(list->head);
+
+	*copy = *list;
+
+}
+
+/*
+ * This function displays all the list on the console, followed by a new line.
+ * WARNING : the print_data function cannot be NULL.
+ */
+void print_persistent_list(const PersistentList *list) {
+
+	const PersistentCell *tmp = list->head;
+	void (*print_data)(void *data) = list->type->print_data;
+
+	while (tmp != NULL) {
+		print_data(tmp->data);
+		tmp = tmp->next;
+	}
+
+	printf("\n");
+
+}
+
+/*
+ * This function add to the top of list the data in parameters, in O(1).
+ * The new cell takes the reference of list to its first cell.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int persistent_add_to_top(PersistentList *list, void *data) {
+
+	PersistentCell *cell = alloc_persistent_cell(data, list->head);
+
+	if (NULL == cell)
+		return 0;
+
+	list->head = cell;
+	list->size += 1;
+
+	return 1;
+
+}
+
+/*
+ * This function removes the first cell of list, in O(1).
+ * It returns 0 if list is empty.
+ * Else it returns 1.
+ */
+int persistent_remove_top(PersistentList *list) {
+
+	PersistentCell *first = list->head;
+
+	if (NULL == first)
+		return 0;
+
+	list->head = first->next;
+	retain_cell(list->head);
+	release_cell(list->type, first);
+	list->size -= 1;
+
+	return 1;
+
+}
+
+/*
+ * This function adds at the end of list the cells of list_to_add, shared and not copied.
+ * The reference to the added cells is taken before the cells of list are copied,
+ * so when list_to_add is list, the copies are linked to the old cells and not to themselves.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int persistent_concat(PersistentList *list, const PersistentList *list_to_add) {
+
+	PersistentCell **end, *added = list_to_add->head;
+	size_t size = list_to_add->size;
+
+	if (NULL == added)
+		return 1;
+
+	retain_cell(added);
+	end = own_prefix(list, list->size);
+	if (NULL == end) {
+		release_cell(list->type, added);
+		return 0;
+	}
+
+	*end = added;
+	list->size += size;
+
+	return 1;
+
+}
+
+/*
+ * This function add after the first occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int persistent_add_after_first_occurrence(PersistentList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	PersistentCell **link, *cell;
+	size_t position = list->size;
+
+	if (reference != NULL) {
+		position = search_position(list, reference, cmp_data);
+		if (position == list->size) {
+			fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+			return 0;
+		}
+		position += 1;
+	}
+
+	cell = alloc_persistent_cell(data, NULL);
+	if (NULL == cell)
+		return 0;
+	link = own_prefix(list, position);
+	if (NULL == link) {
+		/* the cell does not own data yet */
+		free(cell);
+		return 0;
+	}
+
+	/* the new cell takes the reference of the previous cell to the next one */
+	cell->next = *link;
+	*link = cell;
+	list->size += 1;
+
+	return 1;
+
+}
+
+/*
+ * This function remove the first occurrence of target_data in list.
+ * If target_data has not been found, or if there were an allocation problem, it returns 0.
+ * Else it returns 1.
+ */
+int persistent_remove_first_occurrence(PersistentList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	PersistentCell **link, *removed;
+	size_t position = search_position(list, target_data, cmp_data);
+
+	if (position == list->size)
+		return 0;
+
+	link = own_prefix(list, position);
+	if (NULL == link)
+		return 0;
+
+	removed = *link;
+	*link = removed->next;
+	retain_cell(removed->next);
+	release_cell(list->type, removed);
+	list->size -= 1;
+
+	return 1;
+
+}
+
+/*
+ * This function returns the first cell of list whose data is equal to target_data, or NULL.
+ */
+const PersistentCell * persistent_find_first_occurrence(const PersistentList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	const PersistentCell *tmp = list->head;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	while (tmp != NULL && cmp_data(tmp->data, target_data) != 0)
+		tmp = tmp->next;
+
+	return tmp;
+
+}
+
+/*
+ * This function returns the number of elements in list, in O(1).
+ */
+size_t persistent_list_size(const PersistentList *list) {
+
+	return list->size;
+
+}
@@ -0,0 +1,216 @@
+#ifndef HEADER_PERSISTENT_LIST_H_
+#define HEADER_PERSISTENT_LIST_H_
+
+#include <stddef.h>
+#include <stdatomic.h>
+#include "list_type.h"
+
+
+struct _persistent_cell {
+	void *data; /* data of the cell */
+	struct _persistent_cell *next; /* pointer to the next cell, which the cell holds a reference to */
+	_Atomic size_t references; /* number of lists and cells which point to this cell */
+	_Atomic size_t data_references; /* number of cells which share the data of this cell, counted on its owner */
+	struct _persistent_cell *owner; /* cell which owns the data : itself, or the cell it is a copy of */
+};
+/*
+ * Cell of a PersistentList, shared by all the lists which reach it.
+ * A cell is never modified while another list can reach it : a list which modifies a shared part copies it first.
+ * A copy shares the data of its owner, which is freed with free_data when no cell uses it anymore.
+ * The fields of this structure must not be modified outside of persistent_list.c.
+ */
+
+typedef struct _persistent_cell PersistentCell;
+
+struct _persistent_list {
+	const ListType *type; /* functions shared by all the data of the list */
+	PersistentCell *head; /* first cell of the list, which the list holds a reference to */
+	size_t size; /* number of cells in the list */
+};
+/*
+ * Handle on an immutable list whose cells are counted references, shared between handles.
+ * share_persistent_list gives another handle on the same cells in O(1), without copying.
+ * A function which modifies a handle never changes what the other handles see :
+ * it copies the shared cells before the place it modifies (copy on write), and shares the rest.
+ * The handles which share cells must use the same ListType.
+ * The references are counted with atomic operations, so handles sharing cells can be used in different threads
+ * (but one handle must not be used by two threads at the same time).
+ */
+
+typedef struct _persistent_list PersistentList;
+
+
+/*
+ * @Function init_persistent_list
+ * @Params
+ * 		PersistentList *list
+ * 		# handle to initialize #
+ * 		const ListType *type
+ * 		# functions shared by all the data of the list #
+ * @Return void
+ * @Description
+ * 		This function initializes list as an empty list of data of the given type.
+ */
+extern void init_persistent_list(PersistentList *list, const ListType *type);
+
+/*
+ * @Function free_persistent_list
+ * @Params
+ * 		PersistentList *list
+ * 		# handle to release #
+ * @Return void
+ * @Description
+ * 		This function releases the reference of list to its cells.
+ * 		Only the cells which are not reached by another list anymore are freed,
+ * 		and a data is freed with the free_data of the ListType (if it is not NULL) when no cell uses it anymore.
+ * 		At the end of the function, list is an empty list.
+ */
+extern void free_persistent_list(PersistentList *list);
+
+/*
+ * @Function share_persistent_list
+ * @Params
+ * 		PersistentList *copy
+ * 		# handle which receives the list #
+ * 		const PersistentList *list
+ * 		# handle to share #
+ * @Return void
+ * @Description
+ * 		This function gives to copy the cells of list, in O(1), without copying them.
+ * 		copy must be empty or not initialized.
+ * 		Both handles must be released with free_persistent_list.
+ */
+extern void share_persistent_list(PersistentList *copy, const PersistentList *list);
+
+/*
+ * @Function print_persistent_list
+ * @Params
+ * 		const PersistentList *list
+ * 		# handle to print #
+ * @Return void
+ * @Description
+ * 		This function displays all the list on the console, followed by a new line.
+ * 		WARNING : the print_data function cannot be NULL.
+ */
+extern void print_persistent_list(const PersistentList *list);
+
+/*
+ * @Function persistent_add_to_top
+ * @Params
+ * 		PersistentList *list
+ * 		# handle which will be modified #
+ * 		void *data
+ * 		# data to add, owned by the list from now #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function adds data to the top of list, in O(1), sharing all the cells of list.
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int persistent_add_to_top(PersistentList *list, void *data);
+
+/*
+ * @Function persistent_remove_top
+ * @Params
+ * 		PersistentList *list
+ * 		# handle which will be modified #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function removes the first cell of list, in O(1).
+ * 		The cell and its data are freed if no other list reaches them.
+ * 		It returns 0 if list is empty.
+ * 		Else it returns 1.
+ */
+extern int persistent_remove_top(PersistentList *list);
+
+/*
+ * @Function persistent_concat
+ * @Params
+ * 		PersistentList *list
+ * 		# handle which will be modified #
+ * 		const PersistentList *list_to_add
+ * 		# handle whose cells are added at the end of list #
+ * 		# this list is not modified #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function adds at the end of list the cells of list_to_add, which are shared and not copied.
+ * 		The cells of list are walked to reach its end, and copied if they are shared with another list :
+ * 		appending to a shared list copies it, in O(n).
+ * 		list_to_add can be list : the list is then followed by its own old cells.
+ * 		It returns 0 if there were an allocation problem, and list is not modified.
+ * 		Else it returns 1.
+ */
+extern int persistent_concat(PersistentList *list, const PersistentList *list_to_add);
+
+/*
+ * @Function persistent_add_after_first_occurrence
+ * @Params
+ * 		PersistentList *list
+ * 		# handle which will be modified #
+ * 		void *data
+ * 		# data to add, owned by the list from now #
+ * 		void *reference
+ * 		# data reference to add data after it #
+ * 		# if it is NULL, data is added at the end #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function adds data after the first occurrence of reference in list.
+ * 		The cells up to reference are copied only if they are shared with another list, the cells after it stay shared.
+ * 		It returns 0 if there were an allocation problem or reference not found, and list is not modified.
+ * 		Else it returns 1.
+ */
+extern int persistent_add_after_first_occurrence(PersistentList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function persistent_remove_first_occurrence
+ * @Params
+ * 		PersistentList *list
+ * 		# handle which will be modified #
+ * 		void *target_data
+ * 		# data to remove #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function removes the first occurrence of target_data from list.
+ * 		The cells before it are copied only if they are shared with another list, the cells after it stay shared.
+ * 		The removed cell and its data are freed if no other list reaches them.
+ * 		It returns 0 if there were an allocation problem or target_data not found, and list is not modified.
+ * 		Else it returns 1.
+ */
+extern int persistent_remove_first_occurrence(PersistentList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function persistent_find_first_occurrence
+ * @Params
+ * 		const PersistentList *list
+ * 		# handle where target_data is searched #
+ * 		void *target_data
+ * 		# data to find #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return const PersistentCell * # cell where target_data is, or NULL #
+ * @Description
+ * 		This function searches the first occurrence of target_data in list.
+ * 		It returns the cell where the function found target_data, or NULL.
+ */
+extern const PersistentCell * persistent_find_first_occurrence(const PersistentList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function persistent_list_size
+ * @Params
+ * 		const PersistentList *list
+ * 		# handle to measure #
+ * @Return size_t # number of elements in list #
+ * @Description
+ * 		This function returns the number of elements in list, in O(1).
+ */
+extern size_t persistent_list_size(const PersistentList *list);
+
+
+#endif /* HEADER_PERSISTENT_LIST_H_ */
@@ -0,0 +1,263 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "skip_list.h"
+
+
+/*
+ * This function create a SkipNode with 'level' levels, allocated with malloc(3).
+ * It returns NULL if there were an allocation problem.
+ */
+static SkipNode * alloc_skip_node(void *data, unsigned int level) {
+
+	SkipNode *node = NULL;
+	unsigned int i;
+
+	node = (SkipNode *)malloc(sizeof(SkipNode) + level * sizeof(SkipNode *));
+	if (NULL == node) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return NULL;
+	}
+
+	node->data = data;
+	node->level = level;
+	for (i = 0; i < level; i++)
+		node->next[i] = NULL;
+
+	return node;
+
+}
+
+/*
+ * This function draws the level of a new node : level l+1 with probability 1/4 of level l.
+ */
+static unsigned int random_level(SkipList *list) {
+
+	unsigned long long bits;
+	unsigned int level = 1;
+
+	/* xorshift64 */
+	list->seed ^= list->seed << 13;
+	list->seed ^= list->seed >> 7;
+	list->seed ^= list->seed << 17;
+	bits = list->seed;
+
+	while (level < SKIP_LIST_MAX_LEVEL && 0 == (bits & 3)) {
+		level += 1;
+		bits >>= 2;
+	}
+
+	return level;
+
+}
+
+/*
+ * This function fills 'update' with the last node of each level whose data is less than target_data
+ * (or less than or equal to it if 'after_equal' is not 0).
+ * It returns the node which follows update[0].
+ */
+static SkipNode * search_update(const SkipList *list, void *target_data, int after_equal, SkipNode **update) {
+
+	SkipNode *node = list->head;
+	int (*cmp_data)(void *data1, void *data2) = list->type->cmp_data;
+	int i, c;
+
+	for (i = (int)list->level - 1; i >= 0; i--) {
+		while (node->next[i] != NULL) {
+			c = cmp_data(node->next[i]->data, target_data);
+			if (c > 0 || (0 == c && !after_equal))
+				break;
+			node = node->next[i];
+		}
+		if (update != NULL)
+			update[i] = node;
+	}
+
+	return node->next[0];
+
+}
+
+/*
+ * This function initializes list as an empty list of data of the given type.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int init_skip_list(SkipList *list, const ListType *type) {
+
+	list->type = type;
+	list->level = 1;
+	list->size = 0;
+	list->seed = 0x9E3779B97F4A7C15ULL ^ (unsigned long long)(size_t)list;
+	list->head = alloc_skip_node(NULL, SKIP_LIST_MAX_LEVEL);
+
+	return (list->head != NULL);
+
+}
+
+/*
+ * This function frees all the nodes of list, and their data if free_data is not NULL.
+ */
+void free_skip_list(SkipList *list) {
+
+	SkipNode *node = list->head, *save;
+
+	if (NULL == node)
+		return;
+
+	node = node->next[0];
+	while (node != NULL) {
+		save = node->next[0];
+		if (list->type->free_data != NULL)
+			list->type->free_data(&(node->data));
+		free(node);
+		node = save;
+	}
+
+	free(list->head);
+	list->head = NULL;
+	list->level = 1;
+	list->size = 0;
+
+}
+
+/*
+ * This function displays all the list on the console, in order, followed by a new line.
+ * WARNING : the print_data function cannot be NULL.
+ */
+void print_skip_list(const SkipList *list) {
+
+	SkipNode *node;
+
+	for (node = list->head->next[0]; node != NULL; node = node->next[0])
+		list->type->print_data(node->data);
+
+	printf("\n");
+
+}
+
+/*
+ * This function add the data in parameters in list, after the data equal to it.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int skip_list_add(SkipList *list, void *data) {
+
+	SkipNode *update[SKIP_LIST_MAX_LEVEL], *node;
+	unsigned int level, i;
+
+	search_update(list, data, 1, update);
+
+	level = random_level(list);
+	for (i = list->level; i < level; i++)
+		update[i] = list->head;
+
+	node = alloc_skip_node(data, level);
+	if (NULL == node)
+		return 0;
+
+	for (i = 0; i < level; i++) {
+		node->next[i] = update[i]->next[i];
+		update[i]->next[i] = node;
+	}
+	if (level > list->level)
+		list->level = level;
+	list->size += 1;
+
+	return 1;
+
+}
+
+/*
+ * This function search the first occurrence of target_data in list.
+ * It returns the node where the function found target_data, or NULL.
+ */
+SkipNode * skip_list_find(const SkipList *list, void *target_data) {
+
+	SkipNode *node = search_update(list, target_data, 0, NULL);
+
+	if (node != NULL && list->type->cmp_data(node->data, target_data) == 0)
+		return node;
+
+	return NULL;
+
+}
+
+/*
+ * This function search the first data of list which is greater than or equal to target_data.
+ * It returns its node, or NULL.
+ */
+SkipNode * skip_list_lower_bound(const SkipList *list, void *target_data) {
+
+	return search_update(list, target_data, 0, NULL);
+
+}
+
+/*
+ * This function remove the first occurrence of target_data in list, and returns the data of list which was equal to it.
+ * If target_data is not present in list, it returns NULL.
+ */
+void * skip_list_extract(SkipList *list, void *target_data) {
+
+	SkipNode *update[SKIP_LIST_MAX_LEVEL], *node;
+	unsigned int i;
+	void *data;
+
+	node = search_update(list, target_data, 0, update);
+	if (NULL == node || list->type->cmp_data(node->data, target_data) != 0)
+		return NULL;
+
+	for (i = 0; i < node->level; i++)
+		update[i]->next[i] = node->next[i];
+	while (list->level > 1 && NULL == list->head->next[list->level - 1])
+		list->level -= 1;
+	list->size -= 1;
+
+	data = node->data;
+	free(node);
+
+	return data;
+
+}
+
+/*
+ * This function remove the first occurrence of target_data in list.
+ * The node is freed but not its data.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int skip_list_remove(SkipList *list, void *target_data) {
+
+	size_t size = list->size;
+
+	skip_list_extract(list, target_data);
+
+	return (list->size != size);
+
+}
+
+/*
+ * This function calls callback on all the data of list between low and high (both included), in order.
+ * It returns the number of data in the range.
+ */
+size_t skip_list_range(const SkipList *list, void *low, void *high, void (*callback)(void *data, void *context), void *context) {
+
+	SkipNode *node = search_update(list, low, 0, NULL);
+	size_t count = 0;
+
+	while (node != NULL && list->type->cmp_data(node->data, high) <= 0) {
+		callback(node->data, context);
+		count += 1;
+		node = node->next[0];
+	}
+
+	return count;
+
+}
+
+/*
+ * This function returns the number of elements in list, in O(1).
+ */
+size_t skip_list_size(const SkipList *list) {
+
+	return list->size;
+
+}
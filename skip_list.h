@@ -0,0 +1,186 @@
+#ifndef HEADER_SKIP_LIST_H_
+#define HEADER_SKIP_LIST_H_
+
+#include <stddef.h>
+#include "list_type.h"
+
+
+#define SKIP_LIST_MAX_LEVEL 32
+/*
+ * Maximum number of levels of a SkipList : enough for 4^32 data.
+ */
+
+struct _skip_node {
+	void *data; /* data of the node */
+	unsigned int level; /* number of pointers in 'next' */
+	struct _skip_node *next[]; /* pointers to the next node of each level, next[0] is the next node of the list */
+};
+/*
+ * Node of a SkipList.
+ * The nodes of level 0 form a sorted LinkedList : to iterate, follow next[0] until the NULL pointer.
+ */
+
+typedef struct _skip_node SkipNode;
+
+struct _skip_list {
+	const ListType *type; /* functions shared by all the data, cmp_data gives the order */
+	SkipNode *head; /* node without data before the first node, with SKIP_LIST_MAX_LEVEL levels */
+	unsigned int level; /* number of levels used by the nodes */
+	size_t size; /* number of data in the list */
+	unsigned long long seed; /* state of the generator of the levels */
+};
+/*
+ * Skip list : a list kept sorted by the cmp_data of its ListType, with O(log n) expected find, add and remove.
+ * Equal data are kept in their order of addition.
+ */
+
+typedef struct _skip_list SkipList;
+
+
+/*
+ * @Function init_skip_list
+ * @Params
+ * 		SkipList *list
+ * 		# SkipList to initialize #
+ * 		const ListType *type
+ * 		# functions shared by all the data of the list #
+ * 		# cmp_data cannot be NULL #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function initializes list as an empty list of data of the given type.
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int init_skip_list(SkipList *list, const ListType *type);
+
+/*
+ * @Function free_skip_list
+ * @Params
+ * 		SkipList *list
+ * 		# SkipList which will be modified #
+ * @Return void
+ * @Description
+ * 		This function frees all the nodes of list, and their data with the free_data of the ListType.
+ * 		If free_data is NULL, the data are not freed.
+ * 		At the end of the function, list must be initialized again before being used.
+ */
+extern void free_skip_list(SkipList *list);
+
+/*
+ * @Function print_skip_list
+ * @Params
+ * 		SkipList *list
+ * 		# SkipList to read #
+ * @Return void
+ * @Description
+ * 		This function displays all the list on the console, in order, followed by a new line.
+ * 		WARNING : the print_data of the ListType cannot be NULL.
+ */
+extern void print_skip_list(const SkipList *list);
+
+/*
+ * @Function skip_list_add
+ * @Params
+ * 		SkipList *list
+ * 		# SkipList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add the data in parameters in list, after the data equal to it, in O(log n) expected.
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int skip_list_add(SkipList *list, void *data);
+
+/*
+ * @Function skip_list_find
+ * @Params
+ * 		SkipList *list
+ * 		# SkipList to read #
+ * 		void *target_data
+ * 		# data to search in list #
+ * @Return SkipNode * # pointer to the node where there is target_data or NULL #
+ * @Description
+ * 		This function search the first occurrence of target_data in list, in O(log n) expected.
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern SkipNode * skip_list_find(const SkipList *list, void *target_data);
+
+/*
+ * @Function skip_list_lower_bound
+ * @Params
+ * 		SkipList *list
+ * 		# SkipList to read #
+ * 		void *target_data
+ * 		# data to search in list #
+ * @Return SkipNode * # pointer to the first node whose data is not less than target_data, or NULL #
+ * @Description
+ * 		This function search the first data of list which is greater than or equal to target_data, in O(log n) expected.
+ * 		The following data are reached with next[0].
+ */
+extern SkipNode * skip_list_lower_bound(const SkipList *list, void *target_data);
+
+/*
+ * @Function skip_list_remove
+ * @Params
+ * 		SkipList *list
+ * 		# SkipList which will be modified #
+ * 		void *target_data
+ * 		# data to remove of list #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function remove the first occurrence of target_data in list, in O(log n) expected.
+ * 		Like remove_first_occurrence, the node is freed but not its data.
+ * 		If target_data has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int skip_list_remove(SkipList *list, void *target_data);
+
+/*
+ * @Function skip_list_extract
+ * @Params
+ * 		SkipList *list
+ * 		# SkipList which will be modified #
+ * 		void *target_data
+ * 		# data to extract of list #
+ * @Return void * # data which was in list or NULL #
+ * @Description
+ * 		This function remove the first occurrence of target_data in list, and returns the data of list which was equal to it.
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern void * skip_list_extract(SkipList *list, void *target_data);
+
+/*
+ * @Function skip_list_range
+ * @Params
+ * 		SkipList *list
+ * 		# SkipList to read #
+ * 		void *low
+ * 		# smallest data of the range #
+ * 		void *high
+ * 		# greatest data of the range #
+ * 		void (*callback)(void *data, void *context)
+ * 		# pointer to the function called on each data of the range #
+ * 		void *context
+ * 		# pointer given to each call of callback #
+ * @Return size_t # number of data in the range #
+ * @Description
+ * 		This function calls callback on all the data of list between low and high (both included), in order.
+ * 		The first data is found in O(log n) expected, then each following data costs O(1).
+ */
+extern size_t skip_list_range(const SkipList *list, void *low, void *high, void (*callback)(void *data, void *context), void *context);
+
+/*
+ * @Function skip_list_size
+ * @Params
+ * 		SkipList *list
+ * 		# SkipList to read #
+ * @Return size_t # number of elements in list #
+ * @Description
+ * 		This function returns the number of elements in list, in O(1).
+ */
+extern size_t skip_list_size(const SkipList *list);
+
+
+#endif /* HEADER_SKIP_LIST_H_ */
@@ -0,0 +1,480 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "typed_linked_list.h"
+
+
+/*
+ * This function create a TypedCell allocated with malloc(3).
+ * It returns NULL if there were an allocation problem.
+ */
+static TypedCell * alloc_typed_cell(void *data, TypedCell *next) {
+
+	TypedCell *cell = NULL;
+
+	cell = (TypedCell *)malloc(sizeof(TypedCell));
+	if (NULL == cell) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return NULL;
+	}
+
+	cell->data = data;
+	cell->next = next;
+
+	return cell;
+
+}
+
+/*
+ * This function inserts a new cell after previous in list.
+ * If previous is NULL, the cell is inserted at the top of list.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+static int insert_after(TypedLinkedList *list, TypedCell *previous, void *data) {
+
+	TypedCell **link = (NULL == previous) ? &(list->head) : &(previous->next);
+	TypedCell *cell;
+
+	cell = alloc_typed_cell(data, *link);
+	if (NULL == cell)
+		return 0;
+
+	*link = cell;
+	if (previous == list->tail)
+		list->tail = cell;
+	list->size += 1;
+
+	return 1;
+
+}
+
+/*
+ * This function unlinks the cell after previous in list.
+ * If previous is NULL, the first cell is unlinked.
+ * It returns the unlinked cell, whose 'next' field is the NULL pointer.
+ */
+static TypedCell * unlink_after(TypedLinkedList *list, TypedCell *previous) {
+
+	TypedCell **link = (NULL == previous) ? &(list->head) : &(previous->next);
+	TypedCell *cell = *link;
+
+	*link = cell->next;
+	if (cell == list->tail)
+		list->tail = previous;
+	list->size -= 1;
+	cell->next = NULL;
+
+	return cell;
+
+}
+
+/*
+ * This function search the first (or the last if 'last' is not 0) cell of list for which cmp_data(reference, data) is 0.
+ * 'previous' receives the cell before it (NULL for the first cell), and 'found' receives the cell.
+ * It returns 0 if reference has not been found.
+ * Else it returns 1.
+ */
+static int search_with_previous(const TypedLinkedList *list, void *reference, int (*cmp_data)(void *data1, void *data2), int last, TypedCell **previous, TypedCell **found) {
+
+	TypedCell *before = NULL, *tmp = list->head;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	*previous = NULL;
+	*found = NULL;
+	while (tmp != NULL) {
+		if (cmp_data(reference, tmp->data) == 0) {
+			*previous = before;
+			*found = tmp;
+			if (!last)
+				return 1;
+		}
+		before = tmp;
+		tmp = tmp->next;
+	}
+
+	return (*found != NULL);
+
+}
+
+/*
+ * This function initializes list as an empty list of data of the given type.
+ */
+void init_typed_linked_list(TypedLinkedList *list, const ListType *type) {
+
+	list->type = type;
+	list->head = NULL;
+	list->tail = NULL;
+	list->size = 0;
+
+}
+
+/*
+ * This function frees all the cells of list, and their data if free_data is not NULL.
+ * At the end of the function, list is an empty list.
+ */
+void free_typed_linked_list(TypedLinkedList *list) {
+
+	TypedCell *tmp = list->head, *save;
+
+	while (tmp != NULL) {
+		save = tmp->next;
+		if (list->type->free_data != NULL)
+			list->type->free_data(&(tmp->data));
+		free(tmp);
+		tmp = save;
+	}
+
+	init_typed_linked_list(list, list->type);
+
+}
+
+/*
+ * This function displays all the list on the console, followed by a new line.
+ * WARNING : the print_data function cannot be NULL.
+ */
+void print_typed_linked_list(const TypedLinkedList *list) {
+
+	TypedCell *tmp = list->head;
+	void (*print_data)(void *data) = list->type->print_data;
+
+	while (tmp != NULL) {
+		print_data(tmp->data);
+		tmp = tmp->next;
+	}
+
+	printf("\n");
+
+}
+
+/*
+ * This function add to the top of list the data in parameters, in O(1).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int typed_add_to_top(TypedLinkedList *list, void *data) {
+
+	return insert_after(list, NULL, data);
+
+}
+
+/*
+ * This function add at the end of list the data in parameters, in O(1).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int typed_add_at_the_end(TypedLinkedList *list, void *data) {
+
+	return insert_after(list, list->tail, data);
+
+}
+
+/*
+ * This function add after the first occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int typed_add_after_first_occurrence(TypedLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	TypedCell *previous, *found;
+
+	if (NULL == reference)
+		return typed_add_at_the_end(list, data);
+
+	if (!search_with_previous(list, reference, cmp_data, 0, &previous, &found)) {
+		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_after(list, found, data);
+
+}
+
+/*
+ * This function add before the first occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int typed_add_before_first_occurrence(TypedLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	TypedCell *previous, *found;
+
+	if (NULL == reference)
+		return typed_add_at_the_end(list, data);
+
+	if (!search_with_previous(list, reference, cmp_data, 0, &previous, &found)) {
+		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_after(list, previous, data);
+
+}
+
+/*
+ * This function add after the last occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int typed_add_after_last_occurrence(TypedLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	TypedCell *previous, *found;
+
+	if (NULL == reference)
+		return typed_add_at_the_end(list, data);
+
+	if (!search_with_previous(list, reference, cmp_data, 1, &previous, &found)) {
+		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_after(list, found, data);
+
+}
+
+/*
+ * This function add before the last occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int typed_add_before_last_occurrence(TypedLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	TypedCell *previous, *found;
+
+	if (NULL == reference)
+		return typed_add_at_the_end(list, data);
+
+	if (!search_with_previous(list, reference, cmp_data, 1, &previous, &found)) {
+		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_after(list, previous, data);
+
+}
+
+/*
+ * This function remove the first occurrence of target_data in list.
+ * The cell is freed but not its data.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int typed_remove_first_occurrence(TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	TypedCell *extracted = typed_extract_first_occurrence(list, target_data, cmp_data);
+
+	free(extracted);
+
+	return (extracted != NULL);
+
+}
+
+/*
+ * This function remove the last occurrence of target_data in list.
+ * The cell is freed but not its data.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int typed_remove_last_occurrence(TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	TypedCell *extracted = typed_extract_last_occurrence(list, target_data, cmp_data);
+
+	free(extracted);
+
+	return (extracted != NULL);
+
+}
+
+/*
+ * This function remove all occurrences of target_data in list, in one pass.
+ * The cells are freed but not their data.
+ * It returns the number of removed elements.
+ */
+size_t typed_remove_all_occurrence(TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	TypedCell *previous = NULL, *tmp = list->head;
+	size_t count = 0;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	while (tmp != NULL) {
+		if (cmp_data(tmp->data, target_data) == 0) {
+			free(unlink_after(list, previous));
+			count += 1;
+		} else {
+			previous = tmp;
+		}
+		tmp = (NULL == previous) ? list->head : previous->next;
+	}
+
+	return count;
+
+}
+
+/*
+ * This function extract the first occurrence of target_data in list.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+TypedCell * typed_extract_first_occurrence(TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	TypedCell *previous, *found;
+
+	if (!search_with_previous(list, target_data, cmp_data, 0, &previous, &found))
+		return NULL;
+
+	return unlink_after(list, previous);
+
+}
+
+/*
+ * This function extract the last occurrence of target_data in list.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+TypedCell * typed_extract_last_occurrence(TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	TypedCell *previous, *found;
+
+	if (!search_with_previous(list, target_data, cmp_data, 1, &previous, &found))
+		return NULL;
+
+	return unlink_after(list, previous);
+
+}
+
+/*
+ * This function search the first occurrence of target_data in list.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+TypedCell * typed_find_first_occurrence(const TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	TypedCell *tmp = list->head;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	while (tmp != NULL && cmp_data(tmp->data, target_data) != 0)
+		tmp = tmp->next;
+
+	return tmp;
+
+}
+
+/*
+ * This function search the last occurrence of target_data in list.
+ * It returns the cell where the function found target_data, or NULL.
+ */
+TypedCell * typed_find_last_occurrence(const TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	TypedCell *tmp = list->head, *last = NULL;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	while (tmp != NULL) {
+		if (cmp_data(tmp->data, target_data) == 0)
+			last = tmp;
+		tmp = tmp->next;
+	}
+
+	return last;
+
+}
+
+/*
+ * This function returns the number of elements in list, in O(1).
+ */
+size_t typed_linked_list_size(const TypedLinkedList *list) {
+
+	return list->size;
+
+}
+
+/*
+ * This function moves the data of a LinkedList at the end of typed, and frees the cells of list.
+ * It returns 0 if a cell does not use the functions of the ListType of typed, or if there were an allocation problem.
+ * Else it returns 1.
+ */
+int linked_list_to_typed_linked_list(TypedLinkedList *typed, LinkedList **list) {
+
+	LinkedList *tmp;
+	TypedCell *first = NULL, *last = NULL, *cell;
+	size_t count = 0;
+
+	for (tmp = *list; tmp != NULL; tmp = tmp->next) {
+		if (tmp->print_data != typed->type->print_data || tmp->free_data != typed->type->free_data)
+			return 0;
+	}
+
+	for (tmp = *list; tmp != NULL; tmp = tmp->next) {
+		cell = alloc_typed_cell(tmp->data, NULL);
+		if (NULL == cell) {
+			while (first != NULL) {
+				cell = first->next;
+				free(first);
+				first = cell;
+			}
+			return 0;
+		}
+		if (NULL == first)
+			first = cell;
+		else
+			last->next = cell;
+		last = cell;
+		count += 1;
+	}
+
+	if (NULL == first)
+		return 1;
+
+	if (NULL == typed->head)
+		typed->head = first;
+	else
+		typed->tail->next = first;
+	typed->tail = last;
+	typed->size += count;
+
+	/* the data now belong to typed, only the cells of list are freed */
+	for (tmp = *list; tmp != NULL; tmp = tmp->next)
+		tmp->free_data = NULL;
+	free_linked_list(list);
+
+	return 1;
+
+}
+
+/*
+ * This function moves the data of typed at the end of a LinkedList.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int typed_linked_list_to_linked_list(TypedLinkedList *typed, LinkedList **list) {
+
+	LinkedListHeader header;
+	LinkedList *tmp;
+	TypedCell *cell;
+
+	init_linked_list_header(&header);
+	for (cell = typed->head; cell != NULL; cell = cell->next) {
+		if (!header_add_at_the_end(&header, cell->data, typed->type->print_data, typed->type->free_data)) {
+			for (tmp = header.head; tmp != NULL; tmp = tmp->next)
+				tmp->free_data = NULL;
+			free_linked_list_header(&header);
+			return 0;
+		}
+	}
+
+	add_list(list, header.head);
+
+	/* the data now belong to list, only the cells of typed are freed */
+	while (typed->head != NULL) {
+		cell = typed->head->next;
+		free(typed->head);
+		typed->head = cell;
+	}
+	init_typed_linked_list(typed, typed->type);
+
+	return 1;
+
+}
@@ -0,0 +1,358 @@
+#ifndef HEADER_TYPED_LINKED_LIST_H_
+#define HEADER_TYPED_LINKED_LIST_H_
+
+#include <stddef.h>
+#include "list_type.h"
+#include "linked_list.h"
+
+
+struct _typed_cell {
+	void *data; /* data of the cell */
+	struct _typed_cell *next; /* pointer to the next cell of the structure */
+};
+/*
+ * Cell of a TypedLinkedList : only the data and the pointer to the next cell,
+ * the functions which handle the data are in the ListType of the list.
+ */
+
+typedef struct _typed_cell TypedCell;
+
+struct _typed_linked_list {
+	const ListType *type; /* functions shared by all the data of the list */
+	TypedCell *head; /* first cell of the list */
+	TypedCell *tail; /* last cell of the list */
+	size_t size; /* number of cells in the list */
+};
+/*
+ * Linked list whose data all have the same type.
+ * A TypedLinkedList cell is half the size of a LinkedList cell, so a traversal touches half the memory.
+ * The LinkedList stays the list for data of mixed types (see linked_list_to_typed_linked_list).
+ */
+
+typedef struct _typed_linked_list TypedLinkedList;
+
+
+/*
+ * @Function init_typed_linked_list
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList to initialize #
+ * 		const ListType *type
+ * 		# functions shared by all the data of the list #
+ * @Return void
+ * @Description
+ * 		This function initializes list as an empty list of data of the given type.
+ */
+extern void init_typed_linked_list(TypedLinkedList *list, const ListType *type);
+
+/*
+ * @Function free_typed_linked_list
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList to free #
+ * @Return void
+ * @Description
+ * 		This function frees all the cells of list, and their data with the free_data of the ListType.
+ * 		If free_data is NULL, the data are not freed.
+ * 		At the end of the function, list is an empty list.
+ */
+extern void free_typed_linked_list(TypedLinkedList *list);
+
+/*
+ * @Function print_typed_linked_list
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList to read #
+ * @Return void
+ * @Description
+ * 		This function displays all the list on the console, followed by a new line.
+ * 		WARNING : the print_data of the ListType cannot be NULL.
+ */
+extern void print_typed_linked_list(const TypedLinkedList *list);
+
+/*
+ * @Function typed_add_to_top
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add to the top of list the data in parameters, in O(1).
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int typed_add_to_top(TypedLinkedList *list, void *data);
+
+/*
+ * @Function typed_add_at_the_end
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add at the end of list the data in parameters, in O(1).
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int typed_add_at_the_end(TypedLinkedList *list, void *data);
+
+/*
+ * @Function typed_add_after_first_occurrence
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference
+ * 		# data reference to add data after it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add after the first occurrence of reference in list, the data in parameters.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int typed_add_after_first_occurrence(TypedLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function typed_add_before_first_occurrence
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference
+ * 		# data reference to add data before it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add before the first occurrence of reference in list, the data in parameters.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int typed_add_before_first_occurrence(TypedLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function typed_add_after_last_occurrence
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference
+ * 		# data reference to add data after it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add after the last occurrence of reference in list, the data in parameters.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int typed_add_after_last_occurrence(TypedLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function typed_add_before_last_occurrence
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference
+ * 		# data reference to add data before it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add before the last occurrence of reference in list, the data in parameters.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int typed_add_before_last_occurrence(TypedLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function typed_remove_first_occurrence
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function remove the first occurrence of target_data in list.
+ * 		Like remove_first_occurrence, the cell is freed but not its data.
+ * 		If target_data has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int typed_remove_first_occurrence(TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function typed_remove_last_occurrence
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function remove the last occurrence of target_data in list.
+ * 		Like remove_last_occurrence, the cell is freed but not its data.
+ * 		If target_data has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int typed_remove_last_occurrence(TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function typed_remove_all_occurrence
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return size_t # number of removed elements #
+ * @Description
+ * 		This function remove all occurrences of target_data in list, in one pass.
+ * 		The cells are freed but not their data.
+ */
+extern size_t typed_remove_all_occurrence(TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function typed_extract_first_occurrence
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return TypedCell * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function remove the first occurrence of target_data in list, and returns its cell.
+ * 		The 'next' field of the returned cell is the NULL pointer, and the cell must be freed with free(3).
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern TypedCell * typed_extract_first_occurrence(TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function typed_extract_last_occurrence
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return TypedCell * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function remove the last occurrence of target_data in list, and returns its cell.
+ * 		The 'next' field of the returned cell is the NULL pointer, and the cell must be freed with free(3).
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern TypedCell * typed_extract_last_occurrence(TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function typed_find_first_occurrence
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList to read #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return TypedCell * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function search the first occurrence of target_data in list.
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern TypedCell * typed_find_first_occurrence(const TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function typed_find_last_occurrence
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList to read #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return TypedCell * # pointer to the cell where there is target_data or NULL #
+ * @Description
+ * 		This function search the last occurrence of target_data in list.
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern TypedCell * typed_find_last_occurrence(const TypedLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function typed_linked_list_size
+ * @Params
+ * 		TypedLinkedList *list
+ * 		# TypedLinkedList to read #
+ * @Return size_t # number of elements in list #
+ * @Description
+ * 		This function returns the number of elements in list, in O(1).
+ */
+extern size_t typed_linked_list_size(const TypedLinkedList *list);
+
+/*
+ * @Function linked_list_to_typed_linked_list
+ * @Params
+ * 		TypedLinkedList *typed
+ * 		# TypedLinkedList where the data are added at the end #
+ * 		LinkedList **list
+ * 		# LinkedList whose data are moved #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function moves the data of a LinkedList at the end of typed, and frees the cells of list.
+ * 		Every cell of list must use the print_data and free_data of the ListType of typed,
+ * 		else nothing is moved : the LinkedList then keeps data of mixed types and must stay a LinkedList.
+ * 		It returns 0 if the types do not match or if there were an allocation problem (list is then unchanged).
+ * 		Else it returns 1, and list points to the NULL pointer.
+ */
+extern int linked_list_to_typed_linked_list(TypedLinkedList *typed, LinkedList **list);
+
+/*
+ * @Function typed_linked_list_to_linked_list
+ * @Params
+ * 		TypedLinkedList *typed
+ * 		# TypedLinkedList whose data are moved #
+ * 		LinkedList **list
+ * 		# LinkedList where the data are added at the end #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function moves the data of typed at the end of a LinkedList, for example to mix them with data of other types.
+ * 		The cells of the LinkedList use the print_data and free_data of the ListType of typed.
+ * 		If the free_data of the ListType is NULL, so is the one of the cells : free_linked_list then does not free their data.
+ * 		It returns 0 if there were an allocation problem (typed and list are then unchanged).
+ * 		Else it returns 1, and typed is an empty list.
+ */
+extern int typed_linked_list_to_linked_list(TypedLinkedList *typed, LinkedList **list);
+
+
+#endif /* HEADER_TYPED_LINKED_LIST_H_ */
@@ -0,0 +1,506 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unrolled_linked_list.h"
+
+
+#define HALF_CAPACITY (UNROLLED_NODE_CAPACITY / 2)
+
+
+struct _unrolled_position {
+	UnrolledNode *previous; /* node before 'node', NULL if 'node' is the first node */
+	UnrolledNode *node; /* node of the data */
+	unsigned int index; /* index of the data in 'node' */
+};
+/*
+ * Place of a data in an UnrolledLinkedList.
+ */
+
+
+/*
+ * This function create an empty UnrolledNode allocated with malloc(3).
+ * It returns NULL if there were an allocation problem.
+ */
+static UnrolledNode * alloc_unrolled_node(UnrolledNode *next) {
+
+	UnrolledNode *node = NULL;
+
+	node = (UnrolledNode *)malloc(sizeof(UnrolledNode));
+	if (NULL == node) {
+		fprintf(stderr, "error: allocation fail.\n");
+		return NULL;
+	}
+
+	node->next = next;
+	node->count = 0;
+
+	return node;
+
+}
+
+/*
+ * This function inserts data at the index 'index' of node, in list.
+ * If node is NULL, list must be empty.
+ * A full node is split in two halves, except when the data goes after its last data:
+ * then the data goes into the next node if it has room, else into a new node.
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+static int insert_at(UnrolledLinkedList *list, UnrolledNode *node, unsigned int index, void *data) {
+
+	UnrolledNode *new_node;
+
+	if (NULL == node) {
+		node = alloc_unrolled_node(NULL);
+		if (NULL == node)
+			return 0;
+		list->head = node;
+		list->tail = node;
+	} else if (UNROLLED_NODE_CAPACITY == node->count) {
+		if (UNROLLED_NODE_CAPACITY == index && node->next != NULL && node->next->count < UNROLLED_NODE_CAPACITY) {
+			node = node->next;
+			index = 0;
+		} else {
+			new_node = alloc_unrolled_node(node->next);
+			if (NULL == new_node)
+				return 0;
+			node->next = new_node;
+			if (list->tail == node)
+				list->tail = new_node;
+			if (UNROLLED_NODE_CAPACITY == index) {
+				node = new_node;
+				index = 0;
+			} else {
+				memcpy(new_node->data, node->data + HALF_CAPACITY, (UNROLLED_NODE_CAPACITY - HALF_CAPACITY) * sizeof(void *));
+				new_node->count = UNROLLED_NODE_CAPACITY - HALF_CAPACITY;
+				node->count = HALF_CAPACITY;
+				if (index > HALF_CAPACITY) {
+					node = new_node;
+					index -= HALF_CAPACITY;
+				}
+			}
+		}
+	}
+
+	memmove(node->data + index + 1, node->data + index, (node->count - index) * sizeof(void *));
+	node->data[index] = data;
+	node->count += 1;
+	list->size += 1;
+
+	return 1;
+
+}
+
+/*
+ * This function removes the data at 'position' in list, and returns it.
+ * A node which becomes empty is freed, and a node which becomes less than half full
+ * is merged with the next node if they fit in one node, else it takes the first data of the next node.
+ */
+static void * remove_at(UnrolledLinkedList *list, struct _unrolled_position *position) {
+
+	UnrolledNode *node = position->node, *next;
+	void *data = node->data[position->index];
+
+	memmove(node->data + position->index, node->data + position->index + 1, (node->count - position->index - 1) * sizeof(void *));
+	node->count -= 1;
+	list->size -= 1;
+
+	if (0 == node->count) {
+		if (NULL == position->previous)
+			list->head = node->next;
+		else
+			position->previous->next = node->next;
+		if (list->tail == node)
+			list->tail = position->previous;
+		free(node);
+	} else if (node->count < HALF_CAPACITY && node->next != NULL) {
+		next = node->next;
+		if (node->count + next->count <= UNROLLED_NODE_CAPACITY) {
+			memcpy(node->data + node->count, next->data, next->count * sizeof(void *));
+			node->count += next->count;
+			node->next = next->next;
+			if (list->tail == next)
+				list->tail = node;
+			free(next);
+		} else {
+			node->data[node->count] = next->data[0];
+			node->count += 1;
+			memmove(next->data, next->data + 1, (next->count - 1) * sizeof(void *));
+			next->count -= 1;
+		}
+	}
+
+	return data;
+
+}
+
+/*
+ * This function search the first (or the last if 'last' is not 0) data of list for which cmp_data(reference, data) is 0.
+ * 'position' receives the place of this data.
+ * It returns 0 if reference has not been found.
+ * Else it returns 1.
+ */
+static int search_position(const UnrolledLinkedList *list, void *reference, int (*cmp_data)(void *data1, void *data2), int last, struct _unrolled_position *position) {
+
+	UnrolledNode *previous = NULL, *node = list->head;
+	unsigned int i;
+	int found = 0;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	while (node != NULL) {
+		for (i = 0; i < node->count; i++) {
+			if (cmp_data(reference, node->data[i]) == 0) {
+				position->previous = previous;
+				position->node = node;
+				position->index = i;
+				if (!last)
+					return 1;
+				found = 1;
+			}
+		}
+		previous = node;
+		node = node->next;
+	}
+
+	return found;
+
+}
+
+/*
+ * This function initializes list as an empty list of data of the given type.
+ */
+void init_unrolled_linked_list(UnrolledLinkedList *list, const ListType *type) {
+
+	list->type = type;
+	list->head = NULL;
+	list->tail = NULL;
+	list->size = 0;
+
+}
+
+/*
+ * This function frees all the nodes of list, and their data if free_data is not NULL.
+ * At the end of the function, list is an empty list.
+ */
+void free_unrolled_linked_list(UnrolledLinkedList *list) {
+
+	UnrolledNode *node = list->head, *save;
+	unsigned int i;
+
+	while (node != NULL) {
+		save = node->next;
+		if (list->type->free_data != NULL) {
+			for (i = 0; i < node->count; i++)
+				list->type->free_data(&(node->data[i]));
+		}
+		free(node);
+		node = save;
+	}
+
+	init_unrolled_linked_list(list, list->type);
+
+}
+
+/*
+ * This function displays all the list on the console, followed by a new line.
+ * WARNING : the print_data function cannot be NULL.
+ */
+void print_unrolled_linked_list(const UnrolledLinkedList *list) {
+
+	UnrolledNode *node;
+	unsigned int i;
+
+	for (node = list->head; node != NULL; node = node->next) {
+		for (i = 0; i < node->count; i++)
+			list->type->print_data(node->data[i]);
+	}
+
+	printf("\n");
+
+}
+
+/*
+ * This function add to the top of list the data in parameters, in O(1).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int unrolled_add_to_top(UnrolledLinkedList *list, void *data) {
+
+	return insert_at(list, list->head, 0, data);
+
+}
+
+/*
+ * This function add at the end of list the data in parameters, in O(1).
+ * It returns 0 if there were an allocation problem.
+ * Else it returns 1.
+ */
+int unrolled_add_at_the_end(UnrolledLinkedList *list, void *data) {
+
+	return insert_at(list, list->tail, (NULL == list->tail) ? 0 : list->tail->count, data);
+
+}
+
+/*
+ * This function add after the first occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int unrolled_add_after_first_occurrence(UnrolledLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	struct _unrolled_position position;
+
+	if (NULL == reference)
+		return unrolled_add_at_the_end(list, data);
+
+	if (!search_position(list, reference, cmp_data, 0, &position)) {
+		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_at(list, position.node, position.index + 1, data);
+
+}
+
+/*
+ * This function add before the first occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int unrolled_add_before_first_occurrence(UnrolledLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	struct _unrolled_position position;
+
+	if (NULL == reference)
+		return unrolled_add_at_the_end(list, data);
+
+	if (!search_position(list, reference, cmp_data, 0, &position)) {
+		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_at(list, position.node, position.index, data);
+
+}
+
+/*
+ * This function add after the last occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int unrolled_add_after_last_occurrence(UnrolledLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	struct _unrolled_position position;
+
+	if (NULL == reference)
+		return unrolled_add_at_the_end(list, data);
+
+	if (!search_position(list, reference, cmp_data, 1, &position)) {
+		fprintf(stderr, "WARNING: You want to add after an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_at(list, position.node, position.index + 1, data);
+
+}
+
+/*
+ * This function add before the last occurrence of reference in list, the data in parameters.
+ * It returns 0 if there were an allocation problem or reference not found.
+ * Else it returns 1.
+ */
+int unrolled_add_before_last_occurrence(UnrolledLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2)) {
+
+	struct _unrolled_position position;
+
+	if (NULL == reference)
+		return unrolled_add_at_the_end(list, data);
+
+	if (!search_position(list, reference, cmp_data, 1, &position)) {
+		fprintf(stderr, "WARNING: You want to add before an element that not exist.\n");
+		return 0;
+	}
+
+	return insert_at(list, position.node, position.index, data);
+
+}
+
+/*
+ * This function remove the first occurrence of target_data in list.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int unrolled_remove_first_occurrence(UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	struct _unrolled_position position;
+
+	if (!search_position(list, target_data, cmp_data, 0, &position))
+		return 0;
+
+	remove_at(list, &position);
+
+	return 1;
+
+}
+
+/*
+ * This function remove the last occurrence of target_data in list.
+ * If target_data has not been found, it returns 0.
+ * Else it returns 1.
+ */
+int unrolled_remove_last_occurrence(UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	struct _unrolled_position position;
+
+	if (!search_position(list, target_data, cmp_data, 1, &position))
+		return 0;
+
+	remove_at(list, &position);
+
+	return 1;
+
+}
+
+/*
+ * This function remove all occurrences of target_data in list, in one pass.
+ * The kept data are packed in the first nodes, and the nodes left empty are freed.
+ * It returns the number of removed elements.
+ */
+size_t unrolled_remove_all_occurrence(UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	UnrolledNode *read, *write = list->head, *save;
+	unsigned int r, w = 0;
+	size_t removed = 0;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	for (read = list->head; read != NULL; read = read->next) {
+		for (r = 0; r < read->count; r++) {
+			if (cmp_data(read->data[r], target_data) == 0) {
+				removed += 1;
+				continue;
+			}
+			/* 'write' never goes past 'read', so the data are moved in place */
+			if (UNROLLED_NODE_CAPACITY == w) {
+				write->count = UNROLLED_NODE_CAPACITY;
+				write = write->next;
+				w = 0;
+			}
+			write->data[w] = read->data[r];
+			w += 1;
+		}
+	}
+
+	if (NULL == list->head)
+		return 0;
+
+	list->size -= removed;
+	if (0 == list->size) {
+		write = NULL;
+		save = list->head;
+		list->head = NULL;
+	} else {
+		write->count = w;
+		save = write->next;
+		write->next = NULL;
+	}
+	list->tail = write;
+
+	while (save != NULL) {
+		read = save->next;
+		free(save);
+		save = read;
+	}
+
+	return removed;
+
+}
+
+/*
+ * This function extract the first occurrence of target_data in list.
+ * It returns the data of list which was equal to target_data, or NULL.
+ */
+void * unrolled_extract_first_occurrence(UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	struct _unrolled_position position;
+
+	if (!search_position(list, target_data, cmp_data, 0, &position))
+		return NULL;
+
+	return remove_at(list, &position);
+
+}
+
+/*
+ * This function extract the last occurrence of target_data in list.
+ * It returns the data of list which was equal to target_data, or NULL.
+ */
+void * unrolled_extract_last_occurrence(UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	struct _unrolled_position position;
+
+	if (!search_position(list, target_data, cmp_data, 1, &position))
+		return NULL;
+
+	return remove_at(list, &position);
+
+}
+
+/*
+ * This function search the first occurrence of target_data in list.
+ * It returns a pointer to the place of the data in its node, or NULL.
+ */
+void ** unrolled_find_first_occurrence(const UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	UnrolledNode *node;
+	unsigned int i;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	for (node = list->head; node != NULL; node = node->next) {
+		for (i = 0; i < node->count; i++) {
+			if (cmp_data(node->data[i], target_data) == 0)
+				return &(node->data[i]);
+		}
+	}
+
+	return NULL;
+
+}
+
+/*
+ * This function search the last occurrence of target_data in list.
+ * It returns a pointer to the place of the data in its node, or NULL.
+ */
+void ** unrolled_find_last_occurrence(const UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2)) {
+
+	UnrolledNode *node;
+	unsigned int i;
+	void **last = NULL;
+
+	if (NULL == cmp_data)
+		cmp_data = list->type->cmp_data;
+
+	for (node = list->head; node != NULL; node = node->next) {
+		for (i = 0; i < node->count; i++) {
+			if (cmp_data(node->data[i], target_data) == 0)
+				last = &(node->data[i]);
+		}
+	}
+
+	return last;
+
+}
+
+/*
+ * This function returns the number of elements in list, in O(1).
+ */
+size_t unrolled_linked_list_size(const UnrolledLinkedList *list) {
+
+	return list->size;
+
+}
@@ -0,0 +1,330 @@
+#ifndef HEADER_UNROLLED_LINKED_LIST_H_
+#define HEADER_UNROLLED_LINKED_LIST_H_
+
+#include <stddef.h>
+#include "list_type.h"
+
+
+#define UNROLLED_NODE_CAPACITY 6
+/*
+ * Number of data in a node : with the pointer to the next node and the counter,
+ * a node fills a cache line of 64 bytes on a 64 bits architecture.
+ */
+
+struct _unrolled_node {
+	struct _unrolled_node *next; /* pointer to the next node of the structure */
+	unsigned int count; /* number of data used in the node */
+	void *data[UNROLLED_NODE_CAPACITY]; /* data of the node, in the order of the list */
+};
+/*
+ * Node of an UnrolledLinkedList, which holds up to UNROLLED_NODE_CAPACITY consecutive data of the list.
+ */
+
+typedef struct _unrolled_node UnrolledNode;
+
+struct _unrolled_linked_list {
+	const ListType *type; /* functions shared by all the data of the list */
+	UnrolledNode *head; /* first node of the list */
+	UnrolledNode *tail; /* last node of the list */
+	size_t size; /* number of data in the list */
+};
+/*
+ * Unrolled linked list : a linked list of small arrays of data.
+ * A traversal follows one pointer every UNROLLED_NODE_CAPACITY data instead of one pointer per data.
+ * A full node is split in two when a data is inserted in it,
+ * and a node which becomes less than half full is merged with (or refilled from) the next one.
+ */
+
+typedef struct _unrolled_linked_list UnrolledLinkedList;
+
+
+/*
+ * @Function init_unrolled_linked_list
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList to initialize #
+ * 		const ListType *type
+ * 		# functions shared by all the data of the list #
+ * @Return void
+ * @Description
+ * 		This function initializes list as an empty list of data of the given type.
+ */
+extern void init_unrolled_linked_list(UnrolledLinkedList *list, const ListType *type);
+
+/*
+ * @Function free_unrolled_linked_list
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList to free #
+ * @Return void
+ * @Description
+ * 		This function frees all the nodes of list, and their data with the free_data of the ListType.
+ * 		If free_data is NULL, the data are not freed.
+ * 		At the end of the function, list is an empty list.
+ */
+extern void free_unrolled_linked_list(UnrolledLinkedList *list);
+
+/*
+ * @Function print_unrolled_linked_list
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList to read #
+ * @Return void
+ * @Description
+ * 		This function displays all the list on the console, followed by a new line.
+ * 		WARNING : the print_data of the ListType cannot be NULL.
+ */
+extern void print_unrolled_linked_list(const UnrolledLinkedList *list);
+
+/*
+ * @Function unrolled_add_to_top
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add to the top of list the data in parameters, in O(1).
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int unrolled_add_to_top(UnrolledLinkedList *list, void *data);
+
+/*
+ * @Function unrolled_add_at_the_end
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add at the end of list the data in parameters, in O(1).
+ * 		It returns 0 if there were an allocation problem.
+ * 		Else it returns 1.
+ */
+extern int unrolled_add_at_the_end(UnrolledLinkedList *list, void *data);
+
+/*
+ * @Function unrolled_add_after_first_occurrence
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference
+ * 		# data reference to add data after it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add after the first occurrence of reference in list, the data in parameters.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int unrolled_add_after_first_occurrence(UnrolledLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function unrolled_add_before_first_occurrence
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference
+ * 		# data reference to add data before it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add before the first occurrence of reference in list, the data in parameters.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int unrolled_add_before_first_occurrence(UnrolledLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function unrolled_add_after_last_occurrence
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference
+ * 		# data reference to add data after it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add after the last occurrence of reference in list, the data in parameters.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int unrolled_add_after_last_occurrence(UnrolledLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function unrolled_add_before_last_occurrence
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList which will be modified #
+ * 		void *data
+ * 		# generic data to add #
+ * 		void *reference
+ * 		# data reference to add data before it #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection value #
+ * @Description
+ * 		This function add before the last occurrence of reference in list, the data in parameters.
+ * 		If reference is NULL, the data is added at the end of list.
+ * 		It returns 0 if there were an allocation problem or reference not found.
+ * 		Else it returns 1.
+ */
+extern int unrolled_add_before_last_occurrence(UnrolledLinkedList *list, void *data, void *reference, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function unrolled_remove_first_occurrence
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function remove the first occurrence of target_data in list.
+ * 		Like remove_first_occurrence, the data is not freed.
+ * 		If target_data has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int unrolled_remove_first_occurrence(UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function unrolled_remove_last_occurrence
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return int # error detection return #
+ * @Description
+ * 		This function remove the last occurrence of target_data in list.
+ * 		Like remove_last_occurrence, the data is not freed.
+ * 		If target_data has not been found, it returns 0.
+ * 		Else it returns 1.
+ */
+extern int unrolled_remove_last_occurrence(UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function unrolled_remove_all_occurrence
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return size_t # number of removed elements #
+ * @Description
+ * 		This function remove all occurrences of target_data in list, in one pass.
+ * 		The data are not freed.
+ */
+extern size_t unrolled_remove_all_occurrence(UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function unrolled_extract_first_occurrence
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return void * # data which was in list or NULL #
+ * @Description
+ * 		This function remove the first occurrence of target_data in list, and returns the data of list which was equal to it.
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern void * unrolled_extract_first_occurrence(UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function unrolled_extract_last_occurrence
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList which will be modified #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return void * # data which was in list or NULL #
+ * @Description
+ * 		This function remove the last occurrence of target_data in list, and returns the data of list which was equal to it.
+ * 		If target_data is not present in list, it returns NULL.
+ */
+extern void * unrolled_extract_last_occurrence(UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function unrolled_find_first_occurrence
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList to read #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return void ** # pointer to the place of the data in list or NULL #
+ * @Description
+ * 		This function search the first occurrence of target_data in list.
+ * 		It returns a pointer to the place of the data in its node, or NULL if target_data is not present in list.
+ * 		WARNING: the pointer is no longer valid after a modification of list.
+ */
+extern void ** unrolled_find_first_occurrence(const UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function unrolled_find_last_occurrence
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList to read #
+ * 		void *target_data
+ * 		# data to search in list #
+ * 		int (*cmp_data)(void *data1, void *data2)
+ * 		# pointer to a function to compare two same data #
+ * 		# if it is NULL, the cmp_data of the ListType is used #
+ * @Return void ** # pointer to the place of the data in list or NULL #
+ * @Description
+ * 		This function search the last occurrence of target_data in list.
+ * 		It returns a pointer to the place of the data in its node, or NULL if target_data is not present in list.
+ * 		WARNING: the pointer is no longer valid after a modification of list.
+ */
+extern void ** unrolled_find_last_occurrence(const UnrolledLinkedList *list, void *target_data, int (*cmp_data)(void *data1, void *data2));
+
+/*
+ * @Function unrolled_linked_list_size
+ * @Params
+ * 		UnrolledLinkedList *list
+ * 		# UnrolledLinkedList to read #
+ * @Return size_t # number of elements in list #
+ * @Description
+ * 		This function returns the number of elements in list, in O(1).
+ */
+extern size_t unrolled_linked_list_size(const UnrolledLinkedList *list);
+
+
+#endif /* HEADER_UNROLLED_LINKED_LIST_H_ */